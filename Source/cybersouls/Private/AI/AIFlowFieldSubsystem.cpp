@@ -0,0 +1,273 @@
+// AIFlowFieldSubsystem.cpp
+#include "cybersouls/Public/AI/AIFlowFieldSubsystem.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "NavigationSystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("AI Flow Field Rebuild"), STAT_AIFlowFieldRebuild, STATGROUP_Cybersouls);
+
+namespace CybersoulsFlowField
+{
+	// 8-way neighbours, opposite directions differ only in the lowest bit.
+	// Orthogonal steps cost 10, diagonal 14.
+	static const FIntPoint Offsets[8] = {
+		FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1),
+		FIntPoint(1, 1), FIntPoint(-1, -1), FIntPoint(1, -1), FIntPoint(-1, 1)
+	};
+	static const int32 StepCosts[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+	static constexpr int32 Unreachable = MAX_int32;
+
+	// Walkability cache is dropped once it holds this many grids' worth of cells
+	static constexpr int32 MaxCachedGrids = 4;
+}
+
+UAIFlowFieldSubsystem* UAIFlowFieldSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAIFlowFieldSubsystem>() : nullptr;
+}
+
+void UAIFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Cached walkability is only as good as the navmesh it was probed against
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UAIFlowFieldSubsystem::OnNavigationGenerated);
+	}
+}
+
+void UAIFlowFieldSubsystem::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UAIFlowFieldSubsystem::OnNavigationGenerated);
+	}
+
+	WalkableCells.Empty();
+	IntegrationCosts.Empty();
+	FlowDirections.Empty();
+	bFieldValid = false;
+
+	Super::Deinitialize();
+}
+
+TStatId UAIFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+void UAIFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	AActor* Target = FieldTarget.Get();
+	if (!bFlowFieldEnabled || !Target)
+	{
+		bFieldValid = false;
+		return;
+	}
+
+	const FVector TargetLocation = Target->GetActorLocation();
+	if (!bFieldValid || GetWorldCell(TargetLocation) != TargetCell || GetHeightBand(TargetLocation.Z) != TargetHeightBand)
+	{
+		RebuildField(TargetLocation);
+	}
+}
+
+FIntPoint UAIFlowFieldSubsystem::GetWorldCell(const FVector& Location) const
+{
+	const float InvCellSize = 1.0f / FMath::Max(CellSize, 1.0f);
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvCellSize),
+		FMath::FloorToInt32(Location.Y * InvCellSize));
+}
+
+int32 UAIFlowFieldSubsystem::GetHeightBand(float Z) const
+{
+	return FMath::FloorToInt32(Z / FMath::Max(ProbeVerticalExtent, 1.0f));
+}
+
+bool UAIFlowFieldSubsystem::IsWalkable(const FIntPoint& WorldCell, int32 HeightBand)
+{
+	const FIntVector Key(WorldCell.X, WorldCell.Y, HeightBand);
+	if (const bool* bCached = WalkableCells.Find(Key))
+	{
+		return *bCached;
+	}
+
+	bool bWalkable = false;
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		// Probed from the middle of the band, so the answer does not depend on where in it the target stood first
+		const float BandHeight = FMath::Max(ProbeVerticalExtent, 1.0f);
+		const FVector CellCenter((WorldCell.X + 0.5f) * CellSize, (WorldCell.Y + 0.5f) * CellSize, (HeightBand + 0.5f) * BandHeight);
+		const FVector ProbeExtent(CellSize * 0.5f, CellSize * 0.5f, ProbeVerticalExtent);
+
+		FNavLocation NavLocation;
+		bWalkable = NavSys->ProjectPointToNavigation(CellCenter, NavLocation, ProbeExtent);
+	}
+
+	WalkableCells.Add(Key, bWalkable);
+	return bWalkable;
+}
+
+void UAIFlowFieldSubsystem::RebuildField(const FVector& TargetLocation)
+{
+	using namespace CybersoulsFlowField;
+
+	SCOPE_CYCLE_COUNTER(STAT_AIFlowFieldRebuild);
+
+	const int32 Dimension = FMath::Max(GridDimension, 3);
+	const int32 NumCells = Dimension * Dimension;
+
+	TargetCell = GetWorldCell(TargetLocation);
+	GridOrigin = TargetCell - FIntPoint(Dimension / 2, Dimension / 2);
+
+	IntegrationCosts.Init(Unreachable, NumCells);
+	FlowDirections.Init(INDEX_NONE, NumCells);
+
+	// Only the target's band is cached, and only a few grids' worth of it, so a long chase cannot grow it without bound
+	const int32 NewHeightBand = GetHeightBand(TargetLocation.Z);
+	if (NewHeightBand != TargetHeightBand || WalkableCells.Num() > NumCells * MaxCachedGrids)
+	{
+		WalkableCells.Reset();
+	}
+
+	// Walkability for every grid cell at the target's height; only cells new to the cache actually probe
+	TargetHeightBand = NewHeightBand;
+	TBitArray<> Walkable(false, NumCells);
+	for (int32 Y = 0; Y < Dimension; ++Y)
+	{
+		for (int32 X = 0; X < Dimension; ++X)
+		{
+			Walkable[Y * Dimension + X] = IsWalkable(GridOrigin + FIntPoint(X, Y), TargetHeightBand);
+		}
+	}
+
+	// Dijkstra outward from the target cell, always over the whole grid since its centre just moved
+	struct FOpenCell
+	{
+		int32 Cost;
+		int32 Index;
+		bool operator<(const FOpenCell& Other) const { return Cost < Other.Cost; }
+	};
+
+	TArray<FOpenCell> Open;
+	const int32 TargetIndex = (Dimension / 2) * Dimension + (Dimension / 2);
+	IntegrationCosts[TargetIndex] = 0;
+	Open.HeapPush(FOpenCell{ 0, TargetIndex });
+
+	while (Open.Num() > 0)
+	{
+		FOpenCell Current;
+		Open.HeapPop(Current, EAllowShrinking::No);
+		if (Current.Cost > IntegrationCosts[Current.Index])
+		{
+			continue;
+		}
+
+		const int32 CurrentX = Current.Index % Dimension;
+		const int32 CurrentY = Current.Index / Dimension;
+
+		for (int32 Dir = 0; Dir < 8; ++Dir)
+		{
+			const int32 NextX = CurrentX + Offsets[Dir].X;
+			const int32 NextY = CurrentY + Offsets[Dir].Y;
+			if (NextX < 0 || NextY < 0 || NextX >= Dimension || NextY >= Dimension)
+			{
+				continue;
+			}
+
+			const int32 NextIndex = NextY * Dimension + NextX;
+			if (!Walkable[NextIndex])
+			{
+				continue;
+			}
+
+			// No cutting corners past blocked cells
+			if (Offsets[Dir].X != 0 && Offsets[Dir].Y != 0
+				&& (!Walkable[CurrentY * Dimension + NextX] || !Walkable[NextY * Dimension + CurrentX]))
+			{
+				continue;
+			}
+
+			const int32 NewCost = Current.Cost + StepCosts[Dir];
+			if (NewCost < IntegrationCosts[NextIndex])
+			{
+				IntegrationCosts[NextIndex] = NewCost;
+
+				// Flow runs back along the step we just took
+				FlowDirections[NextIndex] = static_cast<int8>(Dir ^ 1);
+				Open.HeapPush(FOpenCell{ NewCost, NextIndex });
+			}
+		}
+	}
+
+	bFieldValid = true;
+}
+
+bool UAIFlowFieldSubsystem::GetFlowWaypoint(const FVector& Location, AActor* Target, FVector& OutWaypoint)
+{
+	using namespace CybersoulsFlowField;
+
+	if (!bFlowFieldEnabled || !Target)
+	{
+		return false;
+	}
+
+	// Retarget; the field for the new target is built on the next tick
+	if (FieldTarget.Get() != Target)
+	{
+		FieldTarget = Target;
+		bFieldValid = false;
+		return false;
+	}
+
+	if (!bFieldValid)
+	{
+		return false;
+	}
+
+	// The field only describes the target's floor, chasers on another one keep using MoveTo
+	if (GetHeightBand(Location.Z) != TargetHeightBand)
+	{
+		return false;
+	}
+
+	const int32 Dimension = FMath::Max(GridDimension, 3);
+	FIntPoint GridCell = GetWorldCell(Location) - GridOrigin;
+	if (GridCell.X < 0 || GridCell.Y < 0 || GridCell.X >= Dimension || GridCell.Y >= Dimension)
+	{
+		return false;
+	}
+
+	int32 Index = GridCell.Y * Dimension + GridCell.X;
+	if (IntegrationCosts[Index] == Unreachable || IntegrationCosts[Index] <= MinFlowDistanceCells * 10)
+	{
+		return false;
+	}
+
+	for (int32 Step = 0; Step < LookaheadCells && FlowDirections[Index] != INDEX_NONE; ++Step)
+	{
+		GridCell += Offsets[FlowDirections[Index]];
+		Index = GridCell.Y * Dimension + GridCell.X;
+	}
+
+	const FIntPoint WorldCell = GridOrigin + GridCell;
+	OutWaypoint = FVector((WorldCell.X + 0.5f) * CellSize, (WorldCell.Y + 0.5f) * CellSize, Location.Z);
+	return true;
+}
+
+void UAIFlowFieldSubsystem::OnNavigationGenerated(ANavigationData* NavData)
+{
+	WalkableCells.Reset();
+	bFieldValid = false;
+}
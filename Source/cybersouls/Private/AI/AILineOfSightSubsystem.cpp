@@ -0,0 +1,153 @@
+// AILineOfSightSubsystem.cpp
+#include "cybersouls/Public/AI/AILineOfSightSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+UAILineOfSightSubsystem* UAILineOfSightSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAILineOfSightSubsystem>() : nullptr;
+}
+
+void UAILineOfSightSubsystem::Deinitialize()
+{
+	Results.Empty();
+	PendingTraces.Empty();
+	InFlightTraces.Empty();
+	TraceDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+void UAILineOfSightSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SubmitPendingTraces();
+	PruneResults(GetWorld()->GetTimeSeconds());
+}
+
+TStatId UAILineOfSightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAILineOfSightSubsystem, STATGROUP_Tickables);
+}
+
+bool UAILineOfSightSubsystem::HasLineOfSight(const AActor* Viewer, const AActor* Target, const FVector& Start, const FVector& End, float MaxResultAge)
+{
+	if (!Viewer || !Target)
+	{
+		return false;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const FLineOfSightKey Key(Viewer, Target);
+
+	// Always refresh for next frame; the latest positions win if asked twice
+	PendingTraces.Add(Key, FPendingTrace{ Start, End });
+
+	FLineOfSightResult& Result = Results.FindOrAdd(Key);
+	Result.LastRequestedTime = Now;
+
+	if (Result.CompletedTime > 0.0 && Now - Result.CompletedTime <= MaxResultAge)
+	{
+		return Result.bHasLineOfSight;
+	}
+
+	// No usable result yet (first look or results went stale), pay for one sync trace
+	Result.bHasLineOfSight = TraceNow(Viewer, Target, Start, End);
+	Result.CompletedTime = Now;
+	return Result.bHasLineOfSight;
+}
+
+void UAILineOfSightSubsystem::SubmitPendingTraces()
+{
+	LastBatchSize = PendingTraces.Num();
+	if (LastBatchSize == 0)
+	{
+		return;
+	}
+
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &UAILineOfSightSubsystem::OnTraceCompleted);
+	}
+
+	UWorld* World = GetWorld();
+	for (const TPair<FLineOfSightKey, FPendingTrace>& Pair : PendingTraces)
+	{
+		const AActor* Viewer = Pair.Key.Key.Get();
+		const AActor* Target = Pair.Key.Value.Get();
+		if (!Viewer || !Target)
+		{
+			continue;
+		}
+
+		const uint32 TraceId = NextTraceId++;
+		InFlightTraces.Add(TraceId, Pair.Key);
+
+		World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single,
+			Pair.Value.Start,
+			Pair.Value.End,
+			ECC_Visibility,
+			MakeQueryParams(Viewer, Target),
+			FCollisionResponseParams::DefaultResponseParam,
+			&TraceDelegate,
+			TraceId
+		);
+	}
+
+	PendingTraces.Reset();
+}
+
+void UAILineOfSightSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FLineOfSightKey Key;
+	if (!InFlightTraces.RemoveAndCopyValue(Datum.UserData, Key))
+	{
+		return;
+	}
+
+	if (FLineOfSightResult* Result = Results.Find(Key))
+	{
+		const bool bBlocked = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+		Result->bHasLineOfSight = !bBlocked;
+		Result->CompletedTime = GetWorld()->GetTimeSeconds();
+	}
+}
+
+void UAILineOfSightSubsystem::PruneResults(double Now)
+{
+	for (auto It = Results.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().Key.IsValid() || !It.Key().Value.IsValid() || Now - It.Value().LastRequestedTime > UnusedResultLifetime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool UAILineOfSightSubsystem::TraceNow(const AActor* Viewer, const AActor* Target, const FVector& Start, const FVector& End) const
+{
+	FHitResult HitResult;
+	return !GetWorld()->LineTraceSingleByChannel(
+		HitResult,
+		Start,
+		End,
+		ECC_Visibility,
+		MakeQueryParams(Viewer, Target)
+	);
+}
+
+FCollisionQueryParams UAILineOfSightSubsystem::MakeQueryParams(const AActor* Viewer, const AActor* Target)
+{
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AILineOfSight), false);
+	QueryParams.AddIgnoredActor(Viewer);
+	QueryParams.AddIgnoredActor(Target);
+	return QueryParams;
+}
@@ -0,0 +1,142 @@
+// AISquadKnowledgeSubsystem.cpp
+#include "cybersouls/Public/AI/AISquadKnowledgeSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+UAISquadKnowledgeSubsystem* UAISquadKnowledgeSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAISquadKnowledgeSubsystem>() : nullptr;
+}
+
+void UAISquadKnowledgeSubsystem::Deinitialize()
+{
+	Areas.Empty();
+	SpotterAreas.Empty();
+
+	Super::Deinitialize();
+}
+
+FIntPoint UAISquadKnowledgeSubsystem::GetArea(const FVector& Location) const
+{
+	const float InvAreaSize = 1.0f / FMath::Max(AreaSize, 1.0f);
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvAreaSize),
+		FMath::FloorToInt32(Location.Y * InvAreaSize));
+}
+
+void UAISquadKnowledgeSubsystem::ReportPlayerSighting(const AActor* Spotter, AActor* Player, const FVector& PlayerLocation)
+{
+	if (!Spotter || !Player)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const FVector SpotterLocation = Spotter->GetActorLocation();
+	const FIntPoint AreaKey = GetArea(SpotterLocation);
+
+	// Spotter walked into a new area, stop counting it in the old one
+	FIntPoint& SpotterArea = SpotterAreas.FindOrAdd(Spotter, AreaKey);
+	if (SpotterArea != AreaKey)
+	{
+		RemoveSpotterFromArea(Spotter, SpotterArea);
+		SpotterArea = AreaKey;
+	}
+
+	FSquadArea& Area = Areas.FindOrAdd(AreaKey);
+	Area.SpotterReportTimes.Add(Spotter, Now);
+
+	Area.Knowledge.Player = Player;
+	Area.Knowledge.LastKnownLocation = PlayerLocation;
+	Area.Knowledge.SpotterLocation = SpotterLocation;
+	Area.Knowledge.Timestamp = Now;
+	RefreshSpotterCount(Area, Now);
+}
+
+void UAISquadKnowledgeSubsystem::ClearSpotter(const AActor* Spotter)
+{
+	FIntPoint AreaKey;
+	if (SpotterAreas.RemoveAndCopyValue(Spotter, AreaKey))
+	{
+		RemoveSpotterFromArea(Spotter, AreaKey);
+	}
+}
+
+bool UAISquadKnowledgeSubsystem::GetPlayerKnowledge(const FVector& Location, float Radius, float MaxAge, FSquadPlayerKnowledge& OutKnowledge) const
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float RadiusSquared = FMath::Square(Radius);
+	const FIntPoint MinArea = GetArea(Location - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxArea = GetArea(Location + FVector(Radius, Radius, 0.0f));
+
+	const FSquadPlayerKnowledge* Best = nullptr;
+	for (int32 X = MinArea.X; X <= MaxArea.X; ++X)
+	{
+		for (int32 Y = MinArea.Y; Y <= MaxArea.Y; ++Y)
+		{
+			const FSquadArea* Area = Areas.Find(FIntPoint(X, Y));
+			if (!Area || !Area->Knowledge.Player.IsValid())
+			{
+				continue;
+			}
+
+			const FSquadPlayerKnowledge& Knowledge = Area->Knowledge;
+			if (Now - Knowledge.Timestamp > MaxAge)
+			{
+				continue;
+			}
+
+			if (FVector::DistSquared(Location, Knowledge.SpotterLocation) > RadiusSquared)
+			{
+				continue;
+			}
+
+			if (!Best || Knowledge.Timestamp > Best->Timestamp)
+			{
+				Best = &Knowledge;
+			}
+		}
+	}
+
+	if (!Best)
+	{
+		return false;
+	}
+
+	OutKnowledge = *Best;
+	return true;
+}
+
+void UAISquadKnowledgeSubsystem::RemoveSpotterFromArea(const AActor* Spotter, const FIntPoint& AreaKey)
+{
+	if (FSquadArea* Area = Areas.Find(AreaKey))
+	{
+		Area->SpotterReportTimes.Remove(Spotter);
+		RefreshSpotterCount(*Area, GetWorld()->GetTimeSeconds());
+
+		// Nobody left to refresh the sighting, so drop the area rather than keep every one ever visited
+		if (Area->SpotterReportTimes.Num() == 0)
+		{
+			Areas.Remove(AreaKey);
+		}
+	}
+}
+
+void UAISquadKnowledgeSubsystem::RefreshSpotterCount(FSquadArea& Area, double Now) const
+{
+	for (auto It = Area.SpotterReportTimes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || Now - It.Value() > SpotterTimeout)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	Area.Knowledge.SpotterCount = Area.SpotterReportTimes.Num();
+}
@@ -0,0 +1,238 @@
+// AIThinkSchedulerSubsystem.cpp
+#include "cybersouls/Public/AI/AIThinkSchedulerSubsystem.h"
+#include "cybersouls/Public/AI/BaseEnemyAIController.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+DECLARE_CYCLE_STAT(TEXT("AI Think"), STAT_AIThink, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Thinks Executed"), STAT_AIThinksExecuted, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Thinks Deferred"), STAT_AIThinksDeferred, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Path Requests Throttled"), STAT_AIPathRequestsThrottled, STATGROUP_Cybersouls);
+
+UAIThinkSchedulerSubsystem* UAIThinkSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAIThinkSchedulerSubsystem>() : nullptr;
+}
+
+void UAIThinkSchedulerSubsystem::Deinitialize()
+{
+	Thinkers.Empty();
+	Cursor = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UAIThinkSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIThinkSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UAIThinkSchedulerSubsystem::RegisterThinker(ABaseEnemyAIController* Controller)
+{
+	if (!Controller)
+	{
+		return;
+	}
+
+	for (const FScheduledThinker& Thinker : Thinkers)
+	{
+		if (Thinker.Controller == Controller)
+		{
+			return;
+		}
+	}
+
+	// Random phase so enemies spawned together do not all come due on the same frame
+	FScheduledThinker& NewThinker = Thinkers.AddDefaulted_GetRef();
+	NewThinker.Controller = Controller;
+	NewThinker.ThinkInterval = GetThinkInterval(Controller->GetLODTier());
+	NewThinker.LastThinkTime = GetWorld()->GetTimeSeconds() - FMath::FRand() * NewThinker.ThinkInterval;
+}
+
+void UAIThinkSchedulerSubsystem::UnregisterThinker(ABaseEnemyAIController* Controller)
+{
+	// Only null the slot; the array may be mid-iteration if this came from a think
+	for (FScheduledThinker& Thinker : Thinkers)
+	{
+		if (Thinker.Controller == Controller)
+		{
+			Thinker.Controller = nullptr;
+			bHasRemovedThinkers = true;
+			return;
+		}
+	}
+}
+
+void UAIThinkSchedulerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	CompactThinkers();
+
+	LastExecutedCount = 0;
+	LastDeferredCount = 0;
+
+	const int32 NumThinkers = Thinkers.Num();
+	if (NumThinkers == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AIThink);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double BudgetSeconds = FrameBudgetMs * 0.001;
+	bool bBudgetSpent = false;
+	int32 NextCursor = Cursor;
+
+	for (int32 Visited = 0; Visited < NumThinkers; ++Visited)
+	{
+		const int32 Index = (Cursor + Visited) % NumThinkers;
+
+		// Copy out, a think may register new controllers and reallocate the array
+		ABaseEnemyAIController* Controller = Thinkers[Index].Controller;
+		if (!IsValid(Controller))
+		{
+			bHasRemovedThinkers = true;
+			continue;
+		}
+
+		if (Now >= Thinkers[Index].NextTierEvaluationTime)
+		{
+			UpdateTier(Thinkers[Index], Now);
+		}
+
+		const double LastThinkTime = Thinkers[Index].LastThinkTime;
+		if (Now - LastThinkTime < Thinkers[Index].ThinkInterval)
+		{
+			continue;
+		}
+
+		if (bBudgetSpent)
+		{
+			++LastDeferredCount;
+			continue;
+		}
+
+		Controller->Think(static_cast<float>(Now - LastThinkTime));
+		Thinkers[Index].LastThinkTime = Now;
+		++LastExecutedCount;
+		NextCursor = (Index + 1) % NumThinkers;
+
+		// At least one think always runs so a single slow brain cannot stall the rest
+		if (FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds)
+		{
+			bBudgetSpent = true;
+		}
+	}
+
+	Cursor = NextCursor;
+
+	SET_DWORD_STAT(STAT_AIThinksExecuted, LastExecutedCount);
+	SET_DWORD_STAT(STAT_AIThinksDeferred, LastDeferredCount);
+}
+
+bool UAIThinkSchedulerSubsystem::TryConsumePathRequest()
+{
+	// Requests also come from outside thinks (possess, alerts), so reset by frame number
+	if (PathBudgetFrame != GFrameCounter)
+	{
+		PathBudgetFrame = GFrameCounter;
+		PathRequestsThisFrame = 0;
+	}
+
+	if (PathRequestsThisFrame >= MaxPathRequestsPerFrame)
+	{
+		INC_DWORD_STAT(STAT_AIPathRequestsThrottled);
+		return false;
+	}
+
+	++PathRequestsThisFrame;
+	return true;
+}
+
+void UAIThinkSchedulerSubsystem::UpdateTier(FScheduledThinker& Thinker, double Now)
+{
+	// Jitter so re-evaluations do not bunch up on one frame either
+	Thinker.NextTierEvaluationTime = Now + TierEvaluationInterval * FMath::FRandRange(0.8f, 1.2f);
+
+	const EAILODTier NewTier = EvaluateTier(Thinker.Controller);
+	Thinker.ThinkInterval = GetThinkInterval(NewTier);
+	Thinker.Controller->SetLODTier(NewTier, Thinker.ThinkInterval, GetMovementTickInterval(NewTier));
+}
+
+EAILODTier UAIThinkSchedulerSubsystem::EvaluateTier(const ABaseEnemyAIController* Controller) const
+{
+	const APawn* Pawn = Controller->GetPawn();
+	const AActor* Player = Controller->GetPlayerTarget();
+	if (!Pawn || !Player)
+	{
+		return EAILODTier::Dormant;
+	}
+
+	const float DistanceSquared = FVector::DistSquared(Pawn->GetActorLocation(), Player->GetActorLocation());
+	const bool bEngaged = Controller->IsEngaged();
+	const bool bOnScreen = Pawn->WasRecentlyRendered(OnScreenTolerance);
+
+	if (DistanceSquared <= FMath::Square(CombatDistance) && (bEngaged || bOnScreen))
+	{
+		return EAILODTier::Combat;
+	}
+
+	if (bEngaged || bOnScreen || DistanceSquared <= FMath::Square(AlertedDistance))
+	{
+		return EAILODTier::Alerted;
+	}
+
+	return EAILODTier::Dormant;
+}
+
+float UAIThinkSchedulerSubsystem::GetThinkInterval(EAILODTier Tier) const
+{
+	switch (Tier)
+	{
+		case EAILODTier::Combat:
+			return CombatThinkInterval;
+		case EAILODTier::Alerted:
+			return AlertedThinkInterval;
+		default:
+			return DormantThinkInterval;
+	}
+}
+
+float UAIThinkSchedulerSubsystem::GetMovementTickInterval(EAILODTier Tier) const
+{
+	switch (Tier)
+	{
+		case EAILODTier::Combat:
+			return CombatMovementTickInterval;
+		case EAILODTier::Alerted:
+			return AlertedMovementTickInterval;
+		default:
+			return DormantMovementTickInterval;
+	}
+}
+
+void UAIThinkSchedulerSubsystem::CompactThinkers()
+{
+	if (!bHasRemovedThinkers)
+	{
+		return;
+	}
+
+	Thinkers.RemoveAll([](const FScheduledThinker& Thinker)
+	{
+		return !IsValid(Thinker.Controller);
+	});
+
+	bHasRemovedThinkers = false;
+	Cursor = Thinkers.Num() > 0 ? Cursor % Thinkers.Num() : 0;
+}
@@ -1,13 +1,18 @@
 #include "cybersouls/Public/AI/BaseEnemyAIController.h"
+#include "cybersouls/Public/AI/AILineOfSightSubsystem.h"
+#include "cybersouls/Public/AI/AIThinkSchedulerSubsystem.h"
+#include "cybersouls/Public/AI/AISquadKnowledgeSubsystem.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
 #include "cybersouls/Public/Character/cybersoulsCharacter.h"
 #include "cybersouls/Public/Character/PlayerCyberState.h"
+#include "cybersouls/Public/Player/CyberSoulsPlayerController.h"
 #include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
 #include "cybersouls/Public/CybersoulsUtils.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
-#include "TimerManager.h"
 
 ABaseEnemyAIController::ABaseEnemyAIController()
 {
@@ -20,6 +25,23 @@ void ABaseEnemyAIController::BeginPlay()
     Super::BeginPlay();
 }
 
+void ABaseEnemyAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UAIThinkSchedulerSubsystem* Scheduler = UAIThinkSchedulerSubsystem::Get(this))
+    {
+        Scheduler->UnregisterThinker(this);
+    }
+
+    if (ACyberSoulsPlayerController* PlayerController = CharacterSwitchSource.Get())
+    {
+        PlayerController->OnCharacterSwitchedNative.Remove(CharacterSwitchedHandle);
+    }
+    CharacterSwitchedHandle.Reset();
+    CharacterSwitchSource.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ABaseEnemyAIController::OnPossess(APawn* InPawn)
 {
     Super::OnPossess(InPawn);
@@ -27,12 +49,32 @@ void ABaseEnemyAIController::OnPossess(APawn* InPawn)
     
     // Initialize player target using the new logic that respects character types
     UpdatePlayerTarget();
+    SubscribeToCharacterSwitches();
+
+    // Thinking is driven by the scheduler rather than Tick
+    if (UAIThinkSchedulerSubsystem* Scheduler = UAIThinkSchedulerSubsystem::Get(this))
+    {
+        Scheduler->RegisterThinker(this);
+    }
 }
 
 void ABaseEnemyAIController::OnUnPossess()
 {
+    if (UAIThinkSchedulerSubsystem* Scheduler = UAIThinkSchedulerSubsystem::Get(this))
+    {
+        Scheduler->UnregisterThinker(this);
+    }
+
+    // Reset without firing transition events, the pawn is going away
+    PerceptionState = EAIPerceptionState::Unaware;
+    PlayerVisibleSinceTime = -1.0;
+    bPlayerVisible = false;
+
     StopAlertingAllies();
     Super::OnUnPossess();
+
+    // Parked in the pool until the next OnPossess
+    ControlledEnemy = nullptr;
 }
 
 bool ABaseEnemyAIController::CanSeeTarget(AActor* Target) const
@@ -42,21 +84,35 @@ bool ABaseEnemyAIController::CanSeeTarget(AActor* Target) const
         return false;
     }
 
+    // Dormant AIs do not trace; distance or an ally alert promotes them first
+    if (LODTier == EAILODTier::Dormant)
+    {
+        return false;
+    }
+
     FVector StartLocation = GetPawn()->GetActorLocation() + FVector(0, 0, EyeHeight);
     FVector EndLocation = Target->GetActorLocation();
     
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(GetPawn());
-    QueryParams.AddIgnoredActor(Target);
-    
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        StartLocation,
-        EndLocation,
-        ECC_Visibility,
-        QueryParams
-    );
+    bool bHit = false;
+    if (UAILineOfSightSubsystem* LineOfSight = UAILineOfSightSubsystem::Get(this))
+    {
+        bHit = !LineOfSight->HasLineOfSight(GetPawn(), Target, StartLocation, EndLocation, MaxLineOfSightAge);
+    }
+    else
+    {
+        FHitResult HitResult;
+        FCollisionQueryParams QueryParams;
+        QueryParams.AddIgnoredActor(GetPawn());
+        QueryParams.AddIgnoredActor(Target);
+        
+        bHit = GetWorld()->LineTraceSingleByChannel(
+            HitResult,
+            StartLocation,
+            EndLocation,
+            ECC_Visibility,
+            QueryParams
+        );
+    }
 
     if (bDebugDrawSightLine && GEngine)
     {
@@ -76,6 +132,137 @@ bool ABaseEnemyAIController::CanSeeTarget(AActor* Target) const
     return !bHit;
 }
 
+void ABaseEnemyAIController::Think(float DeltaTime)
+{
+    UpdatePerception();
+    SyncSquadKnowledge();
+}
+
+void ABaseEnemyAIController::UpdatePerception()
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    if (!IsValid(PlayerTarget) || !GetPawn())
+    {
+        bPlayerVisible = false;
+        PlayerVisibleSinceTime = -1.0;
+        SetPerceptionState(EAIPerceptionState::Unaware);
+        return;
+    }
+
+    bPlayerVisible = CanSeeTarget(PlayerTarget);
+    if (bPlayerVisible)
+    {
+        LastKnownPlayerLocation = PlayerTarget->GetActorLocation();
+        LastPlayerSeenTime = Now;
+        if (PlayerVisibleSinceTime < 0.0)
+        {
+            PlayerVisibleSinceTime = Now;
+        }
+    }
+    else
+    {
+        PlayerVisibleSinceTime = -1.0;
+    }
+
+    const double TimeInState = Now - PerceptionStateEnterTime;
+
+    switch (PerceptionState)
+    {
+    case EAIPerceptionState::Unaware:
+        if (bPlayerVisible)
+        {
+            SetPerceptionState(EAIPerceptionState::Suspicious);
+        }
+        break;
+
+    case EAIPerceptionState::Suspicious:
+        if (bPlayerVisible && Now - PlayerVisibleSinceTime >= SightAcquireTime)
+        {
+            SetPerceptionState(EAIPerceptionState::Engaged);
+        }
+        else if (!bPlayerVisible && TimeInState >= SuspicionTimeout)
+        {
+            SetPerceptionState(EAIPerceptionState::Unaware);
+        }
+        break;
+
+    case EAIPerceptionState::Engaged:
+        if (!bPlayerVisible && Now - LastPlayerSeenTime >= SightLossGraceTime)
+        {
+            SetPerceptionState(EAIPerceptionState::Searching);
+        }
+        break;
+
+    case EAIPerceptionState::Searching:
+        // The player is already known, so any sighting re-engages straight away
+        if (bPlayerVisible)
+        {
+            SetPerceptionState(EAIPerceptionState::Engaged);
+        }
+        else if (TimeInState >= SearchDuration)
+        {
+            SetPerceptionState(EAIPerceptionState::Unaware);
+        }
+        break;
+    }
+}
+
+void ABaseEnemyAIController::SetPerceptionState(EAIPerceptionState NewState)
+{
+    if (NewState == PerceptionState)
+    {
+        return;
+    }
+
+    const EAIPerceptionState OldState = PerceptionState;
+    PerceptionState = NewState;
+    PerceptionStateEnterTime = GetWorld()->GetTimeSeconds();
+
+    UE_LOG(LogTemp, Verbose, TEXT("%s: Perception %s -> %s"),
+        *GetName(),
+        *UEnum::GetValueAsString(OldState),
+        *UEnum::GetValueAsString(NewState));
+
+    OnPerceptionStateChanged(OldState, NewState);
+}
+
+void ABaseEnemyAIController::OnPerceptionStateChanged(EAIPerceptionState OldState, EAIPerceptionState NewState)
+{
+    if (NewState == EAIPerceptionState::Engaged)
+    {
+        HandlePlayerVisibility();
+    }
+    else if (OldState == EAIPerceptionState::Engaged)
+    {
+        HandlePlayerLostVisibility();
+    }
+}
+
+float ABaseEnemyAIController::GetTimeInPerceptionState() const
+{
+    return static_cast<float>(GetWorld()->GetTimeSeconds() - PerceptionStateEnterTime);
+}
+
+void ABaseEnemyAIController::SetLODTier(EAILODTier NewTier, float TickInterval, float MovementTickInterval)
+{
+    if (NewTier == LODTier)
+    {
+        return;
+    }
+
+    LODTier = NewTier;
+    SetActorTickInterval(TickInterval);
+
+    if (ACharacter* ControlledCharacter = Cast<ACharacter>(GetPawn()))
+    {
+        if (UCharacterMovementComponent* Movement = ControlledCharacter->GetCharacterMovement())
+        {
+            Movement->SetComponentTickInterval(MovementTickInterval);
+        }
+    }
+}
+
 float ABaseEnemyAIController::GetDistanceToTarget(AActor* Target) const
 {
     return UCybersoulsUtils::GetDistanceBetweenActors(GetPawn(), Target);
@@ -91,44 +278,42 @@ void ABaseEnemyAIController::AlertNearbyEnemies(AActor* Target)
     CurrentTarget = Target;
     bIsAlertingAllies = true;
     
-    // Initial alert
-    UpdateAlliesWithPlayerLocation();
-    
-    // Set up timer for continuous updates
-    GetWorld()->GetTimerManager().SetTimer(
-        AlertUpdateTimerHandle,
-        this,
-        &ABaseEnemyAIController::UpdateAlliesWithPlayerLocation,
-        AlertUpdateInterval,
-        true
-    );
+    // Allies pick this up from the squad knowledge on their next think
+    if (UAISquadKnowledgeSubsystem* SquadKnowledge = UAISquadKnowledgeSubsystem::Get(this))
+    {
+        SquadKnowledge->ReportPlayerSighting(GetPawn(), Target, Target->GetActorLocation());
+    }
 }
 
-void ABaseEnemyAIController::UpdateAlliesWithPlayerLocation()
+void ABaseEnemyAIController::SyncSquadKnowledge()
 {
-    if (!CurrentTarget || !GetPawn() || !bIsAlertingAllies)
+    UAISquadKnowledgeSubsystem* SquadKnowledge = UAISquadKnowledgeSubsystem::Get(this);
+    if (!SquadKnowledge || !GetPawn())
     {
         return;
     }
 
-    TArray<AActor*> FoundEnemies;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACybersoulsEnemyBase::StaticClass(), FoundEnemies);
-    
-    for (AActor* Enemy : FoundEnemies)
+    // Spotters write, everyone else reads
+    if (bIsAlertingAllies && CurrentTarget)
     {
-        if (Enemy && Enemy != GetPawn())
+        SquadKnowledge->ReportPlayerSighting(GetPawn(), CurrentTarget, CurrentTarget->GetActorLocation());
+        return;
+    }
+
+    FSquadPlayerKnowledge Knowledge;
+    if (SquadKnowledge->GetPlayerKnowledge(GetPawn()->GetActorLocation(), AlertRadius, SquadKnowledgeMaxAge, Knowledge)
+        && Knowledge.Timestamp > LastSquadKnowledgeTime)
+    {
+        LastSquadKnowledgeTime = Knowledge.Timestamp;
+
+        // Only the first news of the player counts as an alert
+        if (PerceptionState == EAIPerceptionState::Unaware || PerceptionState == EAIPerceptionState::Suspicious)
         {
-            if (UCybersoulsUtils::IsActorWithinRange(GetPawn(), Enemy, AlertRadius))
-            {
-                APawn* EnemyPawn = Cast<APawn>(Enemy);
-                if (EnemyPawn && EnemyPawn->GetController())
-                {
-                    if (ABaseEnemyAIController* BaseAI = Cast<ABaseEnemyAIController>(EnemyPawn->GetController()))
-                    {
-                        BaseAI->ReceivePlayerLocationUpdate(CurrentTarget, CurrentTarget->GetActorLocation());
-                    }
-                }
-            }
+            ReceiveAlert(Knowledge.Player.Get(), Knowledge.LastKnownLocation);
+        }
+        else
+        {
+            ReceivePlayerLocationUpdate(Knowledge.Player.Get(), Knowledge.LastKnownLocation);
         }
     }
 }
@@ -137,35 +322,58 @@ void ABaseEnemyAIController::StopAlertingAllies()
 {
     bIsAlertingAllies = false;
     CurrentTarget = nullptr;
-    GetWorld()->GetTimerManager().ClearTimer(AlertUpdateTimerHandle);
+
+    if (UAISquadKnowledgeSubsystem* SquadKnowledge = UAISquadKnowledgeSubsystem::Get(this))
+    {
+        SquadKnowledge->ClearSpotter(GetPawn());
+    }
 }
 
 void ABaseEnemyAIController::UpdatePlayerTarget()
 {
-    // Get the current player character
-    AActor* NewPlayerTarget = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
-    
-    // Check if the new target is a CyberState character - if so, ignore it
-    if (NewPlayerTarget)
+    SetPlayerTargetFromCharacter(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+}
+
+void ABaseEnemyAIController::SubscribeToCharacterSwitches()
+{
+    // Pooled enemies keep their controller, so this only binds on the first possession
+    if (CharacterSwitchedHandle.IsValid())
     {
-        // Only chase default character (cybersoulsCharacter), ignore CyberState
-        APlayerCyberState* CyberStateChar = Cast<APlayerCyberState>(NewPlayerTarget);
-        if (CyberStateChar)
-        {
-            // Player is using CyberState - enemies should not chase
-            PlayerTarget = nullptr;
-            UE_LOG(LogTemp, Warning, TEXT("BaseEnemyAI: Player using CyberState - %s will not chase"), 
-                ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"));
-            return;
-        }
-        
-        // Player is using default character - update target normally
-        if (NewPlayerTarget != PlayerTarget)
-        {
-            PlayerTarget = NewPlayerTarget;
-            UE_LOG(LogTemp, Warning, TEXT("BaseEnemyAI: Updated player target to %s for %s"), 
-                *PlayerTarget->GetName(), 
-                ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"));
-        }
+        return;
+    }
+
+    ACyberSoulsPlayerController* PlayerController = Cast<ACyberSoulsPlayerController>(UGameplayStatics::GetPlayerController(GetWorld(), 0));
+    if (!PlayerController)
+    {
+        return;
+    }
+
+    CharacterSwitchSource = PlayerController;
+    CharacterSwitchedHandle = PlayerController->OnCharacterSwitchedNative.AddUObject(this, &ABaseEnemyAIController::HandlePlayerCharacterSwitched);
+}
+
+void ABaseEnemyAIController::HandlePlayerCharacterSwitched(APawn* NewCharacter)
+{
+    // Parked pooled enemies pick the target up again on possession
+    if (!ControlledEnemy || !GetPawn())
+    {
+        return;
+    }
+
+    SetPlayerTargetFromCharacter(NewCharacter);
+}
+
+void ABaseEnemyAIController::SetPlayerTargetFromCharacter(AActor* PlayerCharacter)
+{
+    // Player is using CyberState - enemies should not chase
+    if (Cast<APlayerCyberState>(PlayerCharacter))
+    {
+        PlayerTarget = nullptr;
+        return;
+    }
+
+    if (PlayerCharacter)
+    {
+        PlayerTarget = PlayerCharacter;
     }
 }
\ No newline at end of file
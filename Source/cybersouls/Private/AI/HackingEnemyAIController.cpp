@@ -4,6 +4,7 @@
 #include "cybersouls/Public/Character/cybersoulsCharacter.h"
 #include "cybersouls/Public/Abilities/HackAbilityComponent.h"
 #include "cybersouls/Public/Abilities/QuickHackComponent.h"
+#include "cybersouls/Public/Abilities/QuickHackManagerComponent.h"
 #include "cybersouls/Public/Attributes/HackingEnemyAttributeComponent.h"
 #include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
 #include "GameFramework/Character.h"
@@ -56,9 +57,9 @@ void AHackingEnemyAIController::OnUnPossess()
 	Super::OnUnPossess();
 }
 
-void AHackingEnemyAIController::Tick(float DeltaTime)
+void AHackingEnemyAIController::Think(float DeltaTime)
 {
-	Super::Tick(DeltaTime);
+	Super::Think(DeltaTime);
 	
 	UpdateHackingBehavior();
 }
@@ -70,12 +71,10 @@ void AHackingEnemyAIController::UpdateHackingBehavior()
 		return;
 	}
 	
-	// Check if player is in sight
-	if (CanSeeTarget(PlayerTarget))
+	// Only act once perception has confirmed the player; alerts and ally
+	// communication are handled by the base class on state transitions
+	if (PerceptionState == EAIPerceptionState::Engaged && bPlayerVisible)
 	{
-		// Handle alert status and ally communication using base class
-		HandlePlayerVisibility();
-		
 		// Hacking enemies don't move - they stay in position
 		StopMovement();
 		
@@ -97,9 +96,6 @@ void AHackingEnemyAIController::UpdateHackingBehavior()
 	}
 	else
 	{
-		// Handle lost visibility using base class
-		HandlePlayerLostVisibility();
-		
 		// Hacking enemies don't move, even when alerted
 		// They stay in their position and hack from range
 		StopMovement();
@@ -115,7 +111,7 @@ void AHackingEnemyAIController::PerformHacking()
 	}
 	
 	// Get hack ability component
-	UHackAbilityComponent* HackAbility = ControlledEnemy->FindComponentByClass<UHackAbilityComponent>();
+	UHackAbilityComponent* HackAbility = ControlledEnemy->GetHackAbility();
 	if (HackAbility && HackAbility->CanActivateAbility())
 	{
 		HackAbility->ActivateAbility();
@@ -130,12 +126,17 @@ void AHackingEnemyAIController::AttemptQuickHack()
 	}
 	
 	// Check if this enemy has QuickHack abilities
-	UHackingEnemyAttributeComponent* HackingAttributes = ControlledEnemy->FindComponentByClass<UHackingEnemyAttributeComponent>();
+	UHackingEnemyAttributeComponent* HackingAttributes = ControlledEnemy->GetHackingAttributes();
 	if (!HackingAttributes || !HackingAttributes->bHasQuickHacks)
 	{
 		return;
 	}
 	
+	if (!bQuickHackComponentsCached)
+	{
+		CacheQuickHackComponents();
+	}
+	
 	// Decide which QuickHack to use
 	EEnemyQuickHackType ChosenType = DecideQuickHackType();
 	
@@ -153,7 +154,7 @@ bool AHackingEnemyAIController::IsInHackRange() const
 	// Use the same hack range as the HackAbilityComponent
 	if (ControlledEnemy)
 	{
-		UHackAbilityComponent* HackComponent = ControlledEnemy->FindComponentByClass<UHackAbilityComponent>();
+		UHackAbilityComponent* HackComponent = ControlledEnemy->GetHackAbility();
 		if (HackComponent)
 		{
 			return GetDistanceToTarget(PlayerTarget) <= HackComponent->GetHackRange();
@@ -170,13 +171,17 @@ bool AHackingEnemyAIController::IsPlayerCastingQuickHack() const
 		return false;
 	}
 	
-	// Check player's QuickHack components
-	TArray<UQuickHackComponent*> PlayerQuickHacks;
-	PlayerTarget->GetComponents<UQuickHackComponent>(PlayerQuickHacks);
+	// Player QuickHacks all live in the manager's slots
+	const AcybersoulsCharacter* PlayerCharacter = Cast<AcybersoulsCharacter>(PlayerTarget);
+	const UQuickHackManagerComponent* QuickHackManager = PlayerCharacter ? PlayerCharacter->GetQuickHackManager() : nullptr;
+	if (!QuickHackManager)
+	{
+		return false;
+	}
 	
-	for (UQuickHackComponent* QuickHack : PlayerQuickHacks)
+	for (int32 Slot = 1; Slot <= UQuickHackManagerComponent::MAX_QUICKHACK_SLOTS; ++Slot)
 	{
-		if (QuickHack && QuickHack->IsQuickHackActive())
+		if (QuickHackManager->IsQuickHackCasting(Slot))
 		{
 			return true;
 		}
@@ -276,9 +281,13 @@ void AHackingEnemyAIController::CacheQuickHackComponents()
 		return;
 	}
 	
-	// Get all QuickHack components
-	TArray<UQuickHackComponent*> QuickHacks;
-	ControlledEnemy->GetComponents<UQuickHackComponent>(QuickHacks);
+	FirewallComponent = nullptr;
+	SystemFreezeComponent = nullptr;
+	InterruptProtocolComponent = nullptr;
+	
+	// Empty until the enemy's BeginPlay, so AttemptQuickHack tries again later
+	const TArray<UQuickHackComponent*>& QuickHacks = ControlledEnemy->GetQuickHacks();
+	bQuickHackComponentsCached = QuickHacks.Num() > 0;
 	
 	// Cache specific types
 	for (UQuickHackComponent* QuickHack : QuickHacks)
@@ -319,9 +328,9 @@ void AHackingEnemyAIController::HandlePlayerLostVisibility()
 bool AHackingEnemyAIController::CanSeeTarget(AActor* Target) const
 {
 	// Check for Ghost Protocol invisibility first
-	if (Target)
+	if (AcybersoulsCharacter* PlayerCharacter = Cast<AcybersoulsCharacter>(Target))
 	{
-		UPlayerAttributeComponent* PlayerAttributes = Target->FindComponentByClass<UPlayerAttributeComponent>();
+		UPlayerAttributeComponent* PlayerAttributes = PlayerCharacter->GetPlayerAttributes();
 		if (PlayerAttributes && PlayerAttributes->bIsInvisibleToHackers)
 		{
 			return false; // Player is invisible to hack enemies
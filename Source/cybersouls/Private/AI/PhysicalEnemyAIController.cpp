@@ -1,5 +1,8 @@
 // PhysicalEnemyAIController.cpp
 #include "cybersouls/Public/AI/PhysicalEnemyAIController.h"
+#include "cybersouls/Public/AI/AIThinkSchedulerSubsystem.h"
+#include "cybersouls/Public/AI/AIFlowFieldSubsystem.h"
+#include "cybersouls/cybersouls.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
 #include "cybersouls/Public/Abilities/AttackAbilityComponent.h"
 #include "GameFramework/Character.h"
@@ -12,6 +15,10 @@
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
+DECLARE_CYCLE_STAT(TEXT("AI Path Request"), STAT_AIPathRequest, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Path Requests Issued"), STAT_AIPathRequestsIssued, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Path Requests Reused"), STAT_AIPathRequestsReused, STATGROUP_Cybersouls);
+
 APhysicalEnemyAIController::APhysicalEnemyAIController()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -19,6 +26,13 @@ APhysicalEnemyAIController::APhysicalEnemyAIController()
 	// Default values for close combat
 	ChaseSpeed = 600.0f;       // Faster chase speed
 	AcceptanceRadius = 80.0f;  // Stop closer to player
+	
+	// Shared settings for every move this controller makes; only the goal changes per request
+	BaseMoveRequest.SetNavigationFilter(nullptr);
+	BaseMoveRequest.SetAllowPartialPath(true);
+	BaseMoveRequest.SetProjectGoalLocation(true);
+	BaseMoveRequest.SetReachTestIncludesAgentRadius(true);
+	BaseMoveRequest.SetUsePathfinding(true);
 }
 
 APhysicalEnemyAIController::~APhysicalEnemyAIController()
@@ -48,85 +62,29 @@ void APhysicalEnemyAIController::BeginPlay()
 	}
 }
 
-void APhysicalEnemyAIController::Tick(float DeltaTime)
+void APhysicalEnemyAIController::Think(float DeltaTime)
 {
-	Super::Tick(DeltaTime);
-	
-	static int TickCounter = 0;
-	TickCounter++;
-	
-	// Log every 30 ticks (roughly every 3 seconds at 0.1s tick interval)
-	if (TickCounter % 30 == 0)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("PhysicalEnemyAI Tick: Enemy=%s, PlayerTarget=%s, Pawn=%s"), 
-			ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("NULL"),
-			PlayerTarget ? *PlayerTarget->GetName() : TEXT("NULL"),
-			GetPawn() ? *GetPawn()->GetName() : TEXT("NULL"));
-	}
+	// Perception is updated by the base class, which fires the transition events
+	Super::Think(DeltaTime);
 	
 	if (!IsValid(PlayerTarget) || !IsValid(GetPawn()))
 	{
 		return;
 	}
 	
-	// Check if we can see the player
-	if (CanSeeTarget(PlayerTarget))
+	switch (PerceptionState)
 	{
-		bHasSeenPlayer = true;
-		LastKnownPlayerLocation = PlayerTarget->GetActorLocation();
-		LastSeenTime = GetWorld()->GetTimeSeconds();
-		
-		// Alert nearby allies
-		AlertNearbyEnemies(PlayerTarget);
-		
-		// Check distance to player
-		float DistanceToPlayer = FVector::Distance(GetPawn()->GetActorLocation(), PlayerTarget->GetActorLocation());
+	case EAIPerceptionState::Engaged:
+		UpdateCombatBehavior(DeltaTime);
+		break;
 		
-		// Log when we first see the player
-		static bool bWasVisible = false;
-		if (!bWasVisible)
-		{
-			float ActualAttackRange = 150.0f; // Default
-			if (ControlledEnemy)
-			{
-				UAttackAbilityComponent* AttackComponent = ControlledEnemy->FindComponentByClass<UAttackAbilityComponent>();
-				if (AttackComponent)
-				{
-					ActualAttackRange = AttackComponent->GetAttackRange();
-				}
-			}
-			UE_LOG(LogTemp, Warning, TEXT("PhysicalEnemyAI: %s spotted player at distance %.1f (AttackRange=%.1f)"), 
-				*GetPawn()->GetName(), DistanceToPlayer, ActualAttackRange);
-		}
-		bWasVisible = true;
+	case EAIPerceptionState::Searching:
+		UpdateSearchBehavior(DeltaTime);
+		break;
 		
-		if (IsInAttackRange())
-		{
-			// Stop moving and attack
-			StopMovement();
-			PerformAttack();
-		}
-		else
-		{
-			// Chase the player
-			MoveToLocation(PlayerTarget->GetActorLocation());
-		}
-	}
-	else if (bHasSeenPlayer)
-	{
-		// Lost sight of player, search last known location
-		float TimeSinceSeen = GetWorld()->GetTimeSeconds() - LastSeenTime;
-		if (TimeSinceSeen < SearchTime)
-		{
-			// Move to last known location
-			MoveToLocation(LastKnownPlayerLocation);
-		}
-		else
-		{
-			// Give up searching
-			bHasSeenPlayer = false;
-			StopMovement();
-		}
+	default:
+		// Unaware and suspicious enemies hold position until perception escalates
+		break;
 	}
 }
 
@@ -170,17 +128,6 @@ void APhysicalEnemyAIController::OnPossess(APawn* InPawn)
 	if (PlayerTarget)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("PhysicalEnemyAI: Player target found: %s"), *PlayerTarget->GetName());
-		
-		// Start pursuing player immediately if visible
-		if (CanSeeTarget(PlayerTarget))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("PhysicalEnemyAI: Can see player, starting movement"));
-			MoveToTarget();
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("PhysicalEnemyAI: Cannot see player initially"));
-		}
 	}
 	else
 	{
@@ -193,91 +140,56 @@ void APhysicalEnemyAIController::OnUnPossess()
 	// Clear attack timer when unpossessing
 	GetWorldTimerManager().ClearTimer(AttackTimerHandle);
 	
+	// OnPossess binds again when a pooled enemy is reused
+	if (UPathFollowingComponent* PathFollowing = GetPathFollowingComponent())
+	{
+		PathFollowing->OnRequestFinished.RemoveAll(this);
+	}
+	
 	Super::OnUnPossess();
 }
 
 
-void APhysicalEnemyAIController::UpdateCombatBehavior()
+void APhysicalEnemyAIController::UpdateCombatBehavior(float DeltaTime)
 {
 	if (!ControlledEnemy || !PlayerTarget || ControlledEnemy->IsDead())
 	{
 		return;
 	}
 	
-	// Player target is set in base class OnPossess
+	// Sight dropped but we are still inside the loss grace period, keep closing in
+	if (!bPlayerVisible)
+	{
+		MoveToLocation(LastKnownPlayerLocation);
+		return;
+	}
 	
-	// Check if player is in sight
-	if (CanSeeTarget(PlayerTarget))
+	if (!IsInAttackRange())
 	{
-		// Update last known location when we can see the player
-		LastKnownPlayerLocation = PlayerTarget->GetActorLocation();
-		bIsSearching = false; // Stop searching if we found the player
-		bIsAlerted = false; // Clear alert status when we see the player
-		
-		// Alert nearby enemies when we first spot the player
-		static bool bWasPlayerVisible = false;
-		if (!bWasPlayerVisible)
+		// Chase the player along the shared flow field when it covers us, otherwise
+		// with a path that tracks the player so it is only requested once
+		if (!MoveAlongFlowField())
 		{
-			HandlePlayerVisibility();
-		}
-		bWasPlayerVisible = true;
-		
-		// Move towards player if not in attack range
-		if (!IsInAttackRange())
-		{
-			// Only start new movement if not already moving
-			FAIRequestID CurrentRequestID = GetCurrentMoveRequestID();
-			if (!CurrentRequestID.IsValid())
-			{
-				MoveToTarget();
-			}
-			UE_LOG(LogTemp, Verbose, TEXT("%s: Chasing player, distance: %.1f"), *ControlledEnemy->GetName(), GetDistanceToTarget(PlayerTarget));
-		}
-		else
-		{
-			// Stop movement and attack
-			StopMovement();
-			
-			// Face the target smoothly
-			if (PlayerTarget)
-			{
-				FVector Direction = (PlayerTarget->GetActorLocation() - ControlledEnemy->GetActorLocation()).GetSafeNormal();
-				FRotator TargetRotation = FRotator(0.0f, Direction.Rotation().Yaw, 0.0f);
-				ControlledEnemy->SetActorRotation(FMath::RInterpTo(ControlledEnemy->GetActorRotation(), TargetRotation, GetWorld()->GetDeltaSeconds(), 10.0f));
-			}
-			
-			// Attack if not already attacking
-			if (!GetWorldTimerManager().IsTimerActive(AttackTimerHandle))
-			{
-				PerformAttack();
-				UE_LOG(LogTemp, Log, TEXT("%s: Attacking player!"), *ControlledEnemy->GetName());
-			}
+			MoveToTarget();
 		}
+		return;
 	}
-	else
+	
+	// Stop and attack
+	if (GetMoveStatus() != EPathFollowingStatus::Idle)
 	{
-		// Update visibility tracking
-		static bool bWasPlayerVisible = true;
-		if (bWasPlayerVisible)
-		{
-			// Just lost sight
-			HandlePlayerLostVisibility();
-		}
-		bWasPlayerVisible = false;
-		
-		// Check if we should respond to an alert
-		if (bIsAlerted && !bIsSearching)
-		{
-			// Move to alert location
-			LastKnownPlayerLocation = AlertLocation;
-			StartSearchBehavior();
-			bIsAlerted = false; // Clear the alert
-		}
-		else if (!bIsSearching)
-		{
-			// Lost sight of player, start search behavior
-			StartSearchBehavior();
-		}
+		StopMovement();
+	}
+	
+	// Face the target smoothly
+	FVector Direction = (PlayerTarget->GetActorLocation() - ControlledEnemy->GetActorLocation()).GetSafeNormal();
+	FRotator TargetRotation = FRotator(0.0f, Direction.Rotation().Yaw, 0.0f);
+	ControlledEnemy->SetActorRotation(FMath::RInterpTo(ControlledEnemy->GetActorRotation(), TargetRotation, DeltaTime, 10.0f));
+	
+	// Attack if not already attacking
+	if (!GetWorldTimerManager().IsTimerActive(AttackTimerHandle))
+	{
+		PerformAttack();
 	}
 }
 
@@ -288,27 +200,84 @@ void APhysicalEnemyAIController::MoveToTarget()
 		return;
 	}
 	
+	// Goal actor moves are observed by the path itself, no need to replan while it is alive
+	if (MoveGoalActor == PlayerTarget && IsFollowingPath())
+	{
+		INC_DWORD_STAT(STAT_AIPathRequestsReused);
+		return;
+	}
+	
 	// Configure movement request
-	FAIMoveRequest MoveRequest;
+	FAIMoveRequest MoveRequest = BaseMoveRequest;
 	MoveRequest.SetGoalActor(PlayerTarget);
 	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
-	MoveRequest.SetNavigationFilter(nullptr);
-	MoveRequest.SetAllowPartialPath(true);
-	MoveRequest.SetProjectGoalLocation(true);
-	MoveRequest.SetReachTestIncludesAgentRadius(true);
-	MoveRequest.SetUsePathfinding(true);
 	
-	// Move to target
-	FNavPathSharedPtr NavPath;
-	MoveTo(MoveRequest, &NavPath);
-	
-	// Debug logging
-	if (NavPath.IsValid())
+	if (IssueMoveRequest(MoveRequest))
 	{
+		MoveGoalActor = PlayerTarget;
 		UE_LOG(LogTemp, Verbose, TEXT("%s: Moving to player"), *ControlledEnemy->GetName());
 	}
 }
 
+bool APhysicalEnemyAIController::MoveAlongFlowField()
+{
+	UAIFlowFieldSubsystem* FlowField = UAIFlowFieldSubsystem::Get(this);
+	if (!FlowField || !FlowField->IsFlowFieldEnabled() || !PlayerTarget || !ControlledEnemy)
+	{
+		return false;
+	}
+	
+	FVector Waypoint;
+	if (!FlowField->GetFlowWaypoint(ControlledEnemy->GetActorLocation(), PlayerTarget, Waypoint))
+	{
+		return false;
+	}
+	
+	// Still heading for (roughly) the same waypoint
+	if (!MoveGoalActor && IsFollowingPath()
+		&& FVector::DistSquared2D(Waypoint, MoveGoalLocation) <= FMath::Square(ReplanDistanceThreshold))
+	{
+		return true;
+	}
+	
+	// Straight move to the waypoint, the field already did the pathfinding
+	FAIMoveRequest MoveRequest = BaseMoveRequest;
+	MoveRequest.SetGoalLocation(Waypoint);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+	MoveRequest.SetUsePathfinding(false);
+	MoveRequest.SetProjectGoalLocation(false);
+	
+	MoveGoalActor = nullptr;
+	MoveGoalLocation = Waypoint;
+	MoveTo(MoveRequest);
+	return true;
+}
+
+bool APhysicalEnemyAIController::IsFollowingPath() const
+{
+	const UPathFollowingComponent* PathFollowing = GetPathFollowingComponent();
+	return PathFollowing && PathFollowing->GetStatus() == EPathFollowingStatus::Moving && PathFollowing->HasValidPath();
+}
+
+bool APhysicalEnemyAIController::IssueMoveRequest(const FAIMoveRequest& MoveRequest)
+{
+	// Over this frame's path budget: keep whatever we are doing and retry next think
+	UAIThinkSchedulerSubsystem* Scheduler = UAIThinkSchedulerSubsystem::Get(this);
+	if (Scheduler && !Scheduler->TryConsumePathRequest())
+	{
+		return false;
+	}
+	
+	SCOPE_CYCLE_COUNTER(STAT_AIPathRequest);
+	INC_DWORD_STAT(STAT_AIPathRequestsIssued);
+	
+	MoveGoalActor = nullptr;
+	
+	FNavPathSharedPtr NavPath;
+	const FPathFollowingRequestResult Result = MoveTo(MoveRequest, &NavPath);
+	return Result.Code != EPathFollowingRequestResult::Failed;
+}
+
 void APhysicalEnemyAIController::PerformAttack()
 {
 	if (!ControlledEnemy || !PlayerTarget || ControlledEnemy->IsDead())
@@ -317,7 +286,7 @@ void APhysicalEnemyAIController::PerformAttack()
 	}
 	
 	// Get attack ability component
-	UAttackAbilityComponent* AttackAbility = ControlledEnemy->FindComponentByClass<UAttackAbilityComponent>();
+	UAttackAbilityComponent* AttackAbility = ControlledEnemy->GetAttackAbility();
 	if (AttackAbility && AttackAbility->CanActivateAbility())
 	{
 		AttackAbility->ActivateAbility();
@@ -332,7 +301,7 @@ bool APhysicalEnemyAIController::IsInAttackRange() const
 	// Use the same attack range as the AttackAbilityComponent
 	if (ControlledEnemy)
 	{
-		UAttackAbilityComponent* AttackComponent = ControlledEnemy->FindComponentByClass<UAttackAbilityComponent>();
+		UAttackAbilityComponent* AttackComponent = ControlledEnemy->GetAttackAbility();
 		if (AttackComponent)
 		{
 			return GetDistanceToTarget(PlayerTarget) <= AttackComponent->GetAttackRange();
@@ -351,10 +320,10 @@ void APhysicalEnemyAIController::OnMoveCompleted(FAIRequestID RequestID, const F
 			ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"));
 			
 		// If we're searching and reached the last known location, stop searching after timeout
-		if (bIsSearching && FVector::Dist(ControlledEnemy->GetActorLocation(), LastKnownPlayerLocation) < AcceptanceRadius)
+		if (PerceptionState == EAIPerceptionState::Searching && FVector::Dist(ControlledEnemy->GetActorLocation(), LastKnownPlayerLocation) < AcceptanceRadius)
 		{
 			UE_LOG(LogTemp, Verbose, TEXT("%s: Reached last known player location, will search for %.1f more seconds"), 
-				ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"), SearchTimeRemaining);
+				ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"), SearchDuration - GetTimeInPerceptionState());
 		}
 	}
 	else if (Result.IsInterrupted())
@@ -376,19 +345,23 @@ void APhysicalEnemyAIController::MoveToLocation(const FVector& Location)
 		return;
 	}
 	
+	// Keep the current path while the goal has only drifted a little
+	if (!MoveGoalActor && IsFollowingPath()
+		&& FVector::DistSquared(Location, MoveGoalLocation) <= FMath::Square(ReplanDistanceThreshold))
+	{
+		INC_DWORD_STAT(STAT_AIPathRequestsReused);
+		return;
+	}
+	
 	// Configure movement request for location
-	FAIMoveRequest MoveRequest;
+	FAIMoveRequest MoveRequest = BaseMoveRequest;
 	MoveRequest.SetGoalLocation(Location);
 	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
-	MoveRequest.SetNavigationFilter(nullptr);
-	MoveRequest.SetAllowPartialPath(true);
-	MoveRequest.SetProjectGoalLocation(true);
-	MoveRequest.SetReachTestIncludesAgentRadius(true);
-	MoveRequest.SetUsePathfinding(true);
 	
-	// Move to location
-	FNavPathSharedPtr NavPath;
-	MoveTo(MoveRequest, &NavPath);
+	if (IssueMoveRequest(MoveRequest))
+	{
+		MoveGoalLocation = Location;
+	}
 }
 
 void APhysicalEnemyAIController::StartSearchBehavior()
@@ -398,9 +371,6 @@ void APhysicalEnemyAIController::StartSearchBehavior()
 		return;
 	}
 	
-	bIsSearching = true;
-	SearchTimeRemaining = MaxSearchTime;
-	
 	// Move to last known location
 	MoveToLocation(LastKnownPlayerLocation);
 	
@@ -409,82 +379,50 @@ void APhysicalEnemyAIController::StartSearchBehavior()
 
 void APhysicalEnemyAIController::UpdateSearchBehavior(float DeltaTime)
 {
-	if (!ControlledEnemy || !PlayerTarget || ControlledEnemy->IsDead())
-	{
-		bIsSearching = false;
-		return;
-	}
-	
-	// Check if we can see the player again
-	if (CanSeeTarget(PlayerTarget))
+	if (!ControlledEnemy || ControlledEnemy->IsDead())
 	{
-		bIsSearching = false;
-		SearchTimeRemaining = 0.0f;
-		UE_LOG(LogTemp, Warning, TEXT("%s: Found player during search!"), *ControlledEnemy->GetName());
 		return;
 	}
 	
-	// Update search timer
-	SearchTimeRemaining -= DeltaTime;
-	
-	// If search time expired, stop searching
-	if (SearchTimeRemaining <= 0.0f)
+	// Follow the last known location as allies keep updating it; the path is reused until it drifts
+	float DistanceToLastKnown = FVector::Dist(ControlledEnemy->GetActorLocation(), LastKnownPlayerLocation);
+	if (DistanceToLastKnown >= AcceptanceRadius * 2.0f)
 	{
-		bIsSearching = false;
-		StopMovement();
-		UE_LOG(LogTemp, Warning, TEXT("%s: Search time expired, giving up"), *ControlledEnemy->GetName());
+		MoveToLocation(LastKnownPlayerLocation);
 		return;
 	}
 	
-	// If we're at the last known location and still searching, look around
-	float DistanceToLastKnown = FVector::Dist(ControlledEnemy->GetActorLocation(), LastKnownPlayerLocation);
-	if (DistanceToLastKnown < AcceptanceRadius * 2.0f)
-	{
-		// Rotate to look around
-		FRotator CurrentRotation = ControlledEnemy->GetActorRotation();
-		CurrentRotation.Yaw += 90.0f * DeltaTime; // Rotate 90 degrees per second
-		ControlledEnemy->SetActorRotation(CurrentRotation);
-	}
+	// At the last known location, look around
+	FRotator CurrentRotation = ControlledEnemy->GetActorRotation();
+	CurrentRotation.Yaw += 90.0f * DeltaTime; // Rotate 90 degrees per second
+	ControlledEnemy->SetActorRotation(CurrentRotation);
 }
 
 void APhysicalEnemyAIController::ReceiveAlert(AActor* AlertTarget, const FVector& InAlertLocation)
 {
-	// Don't respond to alerts if we can already see the player
-	if (CanSeeTarget(PlayerTarget))
-	{
-		return;
-	}
-	
-	// Update the alert location
-	AlertLocation = InAlertLocation;
+	// Investigate the reported location
 	LastKnownPlayerLocation = InAlertLocation;
+	SetPerceptionState(EAIPerceptionState::Searching);
 	
-	// If already searching, just update the location
-	if (bIsSearching)
-	{
-		// Update search destination
-		MoveToLocation(LastKnownPlayerLocation);
-		SearchTimeRemaining = MaxSearchTime; // Reset search timer
-		UE_LOG(LogTemp, Verbose, TEXT("%s: Updated search location to %s"), 
-			ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"),
-			*InAlertLocation.ToString());
-	}
-	else
-	{
-		// Store the alert and it will be processed in UpdateCombatBehavior
-		bIsAlerted = true;
-		UE_LOG(LogTemp, Warning, TEXT("%s: Received alert! Player spotted at %s"), 
-			ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"),
-			*InAlertLocation.ToString());
-	}
+	UE_LOG(LogTemp, Warning, TEXT("%s: Received alert! Player spotted at %s"), 
+		ControlledEnemy ? *ControlledEnemy->GetName() : TEXT("Unknown"),
+		*InAlertLocation.ToString());
 }
 
 void APhysicalEnemyAIController::ReceivePlayerLocationUpdate(AActor* Player, const FVector& PlayerLocation)
 {
 	// Update last known location if we're already tracking this player
-	if (PlayerTarget == Player)
+	if (PlayerTarget != Player)
 	{
-		LastKnownPlayerLocation = PlayerLocation;
+		return;
+	}
+	
+	LastKnownPlayerLocation = PlayerLocation;
+	
+	// Fresh news from an ally keeps the search going
+	if (PerceptionState == EAIPerceptionState::Searching)
+	{
+		PerceptionStateEnterTime = GetWorld()->GetTimeSeconds();
 	}
 }
 
@@ -501,7 +439,37 @@ void APhysicalEnemyAIController::HandlePlayerLostVisibility()
 {
 	// Stop alerting when we lose sight
 	StopAlertingAllies();
+}
+
+void APhysicalEnemyAIController::OnPerceptionStateChanged(EAIPerceptionState OldState, EAIPerceptionState NewState)
+{
+	Super::OnPerceptionStateChanged(OldState, NewState);
+	
+	if (!ControlledEnemy)
+	{
+		return;
+	}
 	
-	// Start search behavior
-	StartSearchBehavior();
+	switch (NewState)
+	{
+	case EAIPerceptionState::Engaged:
+		UE_LOG(LogTemp, Warning, TEXT("PhysicalEnemyAI: %s spotted player at distance %.1f"), 
+			*ControlledEnemy->GetName(), GetDistanceToTarget(PlayerTarget));
+		break;
+		
+	case EAIPerceptionState::Searching:
+		StartSearchBehavior();
+		break;
+		
+	case EAIPerceptionState::Unaware:
+		StopMovement();
+		if (OldState == EAIPerceptionState::Searching)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: Search time expired, giving up"), *ControlledEnemy->GetName());
+		}
+		break;
+		
+	default:
+		break;
+	}
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 #include "cybersouls/Public/Abilities/AttackAbilityComponent.h"
 #include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
 #include "cybersouls/Public/Attributes/PhysicalEnemyAttributeComponent.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Character/cybersoulsCharacter.h"
+#include "cybersouls/Public/Combat/DamageQueueSubsystem.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
@@ -53,12 +56,14 @@ void UAttackAbilityComponent::PerformAttack()
 		return;
 	}
 	
-	// Deal damage to player's integrity
-	UPlayerAttributeComponent* PlayerAttributes = Target->FindComponentByClass<UPlayerAttributeComponent>();
-	if (PlayerAttributes)
+	// Deal damage to player's integrity, batched with any other hits this frame
+	AcybersoulsCharacter* PlayerCharacter = Cast<AcybersoulsCharacter>(Target);
+	UPlayerAttributeComponent* PlayerAttributes = PlayerCharacter ? PlayerCharacter->GetPlayerAttributes() : nullptr;
+	UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(this);
+	if (PlayerAttributes && DamageQueue)
 	{
 		float Damage = GetAttackDamage();
-		PlayerAttributes->TakeDamage(Damage);
+		DamageQueue->QueueDamage(GetOwner(), PlayerCharacter, Damage, EDamageType::Physical);
 		
 		UE_LOG(LogTemp, Warning, TEXT("%s attacked player for %f damage"), 
 			*GetOwner()->GetName(), Damage);
@@ -104,9 +109,10 @@ float UAttackAbilityComponent::GetAttackCooldown() const
 
 UPhysicalEnemyAttributeComponent* UAttackAbilityComponent::GetEnemyAttributes() const
 {
-	if (GetOwner())
+	// Read through the owner's component cache
+	if (ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(GetOwner()))
 	{
-		return GetOwner()->FindComponentByClass<UPhysicalEnemyAttributeComponent>();
+		return Enemy->GetPhysicalAttributes();
 	}
 	return nullptr;
 }
\ No newline at end of file
@@ -60,4 +60,10 @@ void UBaseAbilityComponent::ActivateAbility()
 void UBaseAbilityComponent::DeactivateAbility()
 {
 	bIsAbilityActive = false;
+}
+
+void UBaseAbilityComponent::ResetAbility()
+{
+	bIsAbilityActive = false;
+	CurrentCooldown = 0.0f;
 }
\ No newline at end of file
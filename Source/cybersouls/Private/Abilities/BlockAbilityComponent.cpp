@@ -15,6 +15,15 @@ void UBlockAbilityComponent::BeginPlay()
 	Super::BeginPlay();
 	
 	CurrentBlockCharges = MaxBlockCharges;
+	BuildBlockableMask();
+}
+
+void UBlockAbilityComponent::ResetAbility()
+{
+	Super::ResetAbility();
+	
+	CurrentBlockCharges = MaxBlockCharges;
+	BuildBlockableMask();
 }
 
 bool UBlockAbilityComponent::TryBlock(EBodyPart AttackedBodyPart)
@@ -40,7 +49,22 @@ bool UBlockAbilityComponent::TryBlock(EBodyPart AttackedBodyPart)
 
 bool UBlockAbilityComponent::CanBlock(EBodyPart BodyPart) const
 {
-	return BlockableBodyParts.Contains(BodyPart);
+	return (BlockableMask & FBodyPartZoneTable::PartBit(BodyPart)) != 0;
+}
+
+void UBlockAbilityComponent::BuildBlockableMask()
+{
+	// Parts this enemy's archetype has no hit zone for can never be hit, so never match them
+	const ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(GetOwner());
+
+	BlockableMask = 0;
+	for (EBodyPart Part : BlockableBodyParts)
+	{
+		if (Part != EBodyPart::None && (!Enemy || Enemy->HasBodyPart(Part)))
+		{
+			BlockableMask |= FBodyPartZoneTable::PartBit(Part);
+		}
+	}
 }
 
 void UBlockAbilityComponent::ConsumeBlockCharge()
@@ -17,6 +17,15 @@ void UDodgeAbilityComponent::BeginPlay()
 	Super::BeginPlay();
 	
 	CurrentDodgeCharges = MaxDodgeCharges;
+	BuildDodgeableMask();
+}
+
+void UDodgeAbilityComponent::ResetAbility()
+{
+	Super::ResetAbility();
+	
+	CurrentDodgeCharges = MaxDodgeCharges;
+	BuildDodgeableMask();
 }
 
 bool UDodgeAbilityComponent::TryDodge(EBodyPart AttackedBodyPart, AActor* Attacker)
@@ -43,7 +52,22 @@ bool UDodgeAbilityComponent::TryDodge(EBodyPart AttackedBodyPart, AActor* Attack
 
 bool UDodgeAbilityComponent::CanDodge(EBodyPart BodyPart) const
 {
-	return DodgeableBodyParts.Contains(BodyPart);
+	return (DodgeableMask & FBodyPartZoneTable::PartBit(BodyPart)) != 0;
+}
+
+void UDodgeAbilityComponent::BuildDodgeableMask()
+{
+	// Parts this enemy's archetype has no hit zone for can never be hit, so never match them
+	const ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(GetOwner());
+
+	DodgeableMask = 0;
+	for (EBodyPart Part : DodgeableBodyParts)
+	{
+		if (Part != EBodyPart::None && (!Enemy || Enemy->HasBodyPart(Part)))
+		{
+			DodgeableMask |= FBodyPartZoneTable::PartBit(Part);
+		}
+	}
 }
 
 void UDodgeAbilityComponent::ConsumeDodgeCharge()
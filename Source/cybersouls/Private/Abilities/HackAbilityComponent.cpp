@@ -3,6 +3,7 @@
 #include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
 #include "cybersouls/Public/Attributes/HackingEnemyAttributeComponent.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Character/cybersoulsCharacter.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
@@ -66,7 +67,8 @@ void UHackAbilityComponent::PerformContinuousHack(float DeltaTime)
 	}
 	
 	// Increase hack progress on player
-	UPlayerAttributeComponent* PlayerAttributes = Target->FindComponentByClass<UPlayerAttributeComponent>();
+	AcybersoulsCharacter* PlayerCharacter = Cast<AcybersoulsCharacter>(Target);
+	UPlayerAttributeComponent* PlayerAttributes = PlayerCharacter ? PlayerCharacter->GetPlayerAttributes() : nullptr;
 	if (PlayerAttributes)
 	{
 		float HackAmount = GetHackRate() * DeltaTime;
@@ -120,9 +122,10 @@ float UHackAbilityComponent::GetHackRange() const
 
 UHackingEnemyAttributeComponent* UHackAbilityComponent::GetEnemyAttributes() const
 {
-	if (GetOwner())
+	// Read through the owner's component cache instead of searching every tick
+	if (ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(GetOwner()))
 	{
-		return GetOwner()->FindComponentByClass<UHackingEnemyAttributeComponent>();
+		return Enemy->GetHackingAttributes();
 	}
 	return nullptr;
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 // PassiveAbilityComponent.cpp
 #include "cybersouls/Public/Abilities/PassiveAbilityComponent.h"
-#include "TimerManager.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
 #include "Engine/Engine.h"
 
 UPassiveAbilityComponent::UPassiveAbilityComponent()
@@ -72,14 +72,10 @@ bool UPassiveAbilityComponent::CanUseQuickHacks() const
 
 void UPassiveAbilityComponent::ActivateExecutionChains()
 {
-	bExecutionChainsActive = true;
-	
-	// Set timer to deactivate after window expires
-	GetWorld()->GetTimerManager().SetTimer(ExecutionChainsTimerHandle, this, &UPassiveAbilityComponent::DeactivateExecutionChains, ExecutionChainsWindow, false);
-}
-
-void UPassiveAbilityComponent::DeactivateExecutionChains()
-{
-	bExecutionChainsActive = false;
-	UE_LOG(LogTemp, Warning, TEXT("Execution Chains: Deactivated"));
+	// Each kill restarts the window; the status effect sets and clears bExecutionChainsActive
+	UStatusEffectComponent* StatusEffects = GetOwner() ? GetOwner()->FindComponentByClass<UStatusEffectComponent>() : nullptr;
+	if (StatusEffects)
+	{
+		StatusEffects->ApplyEffect(EStatusEffectType::ExecutionChains, ExecutionChainsWindow, EStatusEffectStackRule::Refresh);
+	}
 }
\ No newline at end of file
@@ -3,14 +3,15 @@
 #include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
 #include "cybersouls/Public/Attributes/EnemyAttributeComponent.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
 #include "cybersouls/Public/Abilities/BlockAbilityComponent.h"
 #include "cybersouls/Public/Abilities/DodgeAbilityComponent.h"
 #include "cybersouls/Public/Character/cybersoulsCharacter.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
+#include "cybersouls/Public/Combat/DamageQueueSubsystem.h"
 #include "Engine/Engine.h"
 #include "TimerManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/KismetSystemLibrary.h"
-#include "Kismet/GameplayStatics.h"
 
 UQuickHackComponent::UQuickHackComponent()
 {
@@ -21,6 +22,12 @@ void UQuickHackComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	// Listen for enemy deaths so marked enemies can trigger Cascade Virus
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		EnemyKilledHandle = Registry->OnEnemyKilled.AddUObject(this, &UQuickHackComponent::HandleRegisteredEnemyKilled);
+	}
+	
 	// Set ability name based on hack type
 	switch (QuickHackType)
 	{
@@ -76,6 +83,17 @@ void UQuickHackComponent::BeginPlay()
 	}
 }
 
+void UQuickHackComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->OnEnemyKilled.Remove(EnemyKilledHandle);
+	}
+	EnemyKilledHandle.Reset();
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 void UQuickHackComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -133,6 +151,40 @@ void UQuickHackComponent::InterruptQuickHack()
 	}
 }
 
+void UQuickHackComponent::ResetAbility()
+{
+	Super::ResetAbility();
+	
+	CurrentCastTime = 0.0f;
+	CurrentTarget = nullptr;
+	
+	// Marks and pending cascade kills refer to enemies a reset is about to reuse
+	if (UWorld* World = GetWorld())
+	{
+		for (FTimerHandle& TimerHandle : CascadeTimers)
+		{
+			World->GetTimerManager().ClearTimer(TimerHandle);
+		}
+	}
+	CascadeTimers.Reset();
+	MarkedEnemies.Reset();
+}
+
+void UQuickHackComponent::RestoreCheckpointState(float CooldownRemaining, float CastElapsed, AActor* Target)
+{
+	ResetAbility();
+	CurrentCooldown = FMath::Max(0.0f, CooldownRemaining);
+	
+	// Resume the cast directly, ActivateAbility would restart the cooldown and retarget
+	if (IsValid(Target))
+	{
+		CurrentTarget = Target;
+		// Inverse of GetCastElapsed
+		CurrentCastTime = FMath::Clamp(CastElapsed, 0.0f, CastTime);
+		bIsAbilityActive = true;
+	}
+}
+
 void UQuickHackComponent::ActivateAbility()
 {
 	// If no target is set and this is a player-owned component, get target from crosshair
@@ -147,26 +199,32 @@ void UQuickHackComponent::ActivateAbility()
 				// Special case for InterruptProtocol - can target any enemy casting QuickHack
 				if (QuickHackType == EQuickHackType::InterruptProtocol && !CurrentTarget)
 				{
-					// Find all enemies in the world
-					TArray<AActor*> FoundEnemies;
-					UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACybersoulsEnemyBase::StaticClass(), FoundEnemies);
-					
-					for (AActor* Enemy : FoundEnemies)
+					// Only netrunners carry QuickHacks, so scan their registry buckets
+					if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
 					{
-						TArray<UQuickHackComponent*> QuickHacks;
-						Enemy->GetComponents<UQuickHackComponent>(QuickHacks);
-						
-						for (UQuickHackComponent* QH : QuickHacks)
+						const EEnemyType CasterTypes[] = { EEnemyType::Netrunner, EEnemyType::BuffNetrunner, EEnemyType::DebuffNetrunner };
+						for (EEnemyType CasterType : CasterTypes)
 						{
-							if (QH->IsQuickHackActive())
+							for (ACybersoulsEnemyBase* Enemy : Registry->GetEnemiesOfType(CasterType))
 							{
-								CurrentTarget = Enemy;
-								UE_LOG(LogTemp, Warning, TEXT("Found enemy casting QuickHack - using as InterruptProtocol target"));
-								break;
+								TArray<UQuickHackComponent*> QuickHacks;
+								Enemy->GetComponents<UQuickHackComponent>(QuickHacks);
+								
+								for (UQuickHackComponent* QH : QuickHacks)
+								{
+									if (QH->IsQuickHackActive())
+									{
+										CurrentTarget = Enemy;
+										UE_LOG(LogTemp, Warning, TEXT("Found enemy casting QuickHack - using as InterruptProtocol target"));
+										break;
+									}
+								}
+								
+								if (CurrentTarget) break;
 							}
+							
+							if (CurrentTarget) break;
 						}
-						
-						if (CurrentTarget) break;
 					}
 				}
 			}
@@ -212,7 +270,11 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 		return;
 	}
 	
-	UPlayerAttributeComponent* PlayerAttributes = CurrentTarget->FindComponentByClass<UPlayerAttributeComponent>();
+	AcybersoulsCharacter* TargetCharacter = Cast<AcybersoulsCharacter>(CurrentTarget);
+	UPlayerAttributeComponent* PlayerAttributes = TargetCharacter ? TargetCharacter->GetPlayerAttributes() : nullptr;
+	
+	// Timed effects live on the target, so they stack and end with it
+	UStatusEffectComponent* TargetEffects = CurrentTarget->FindComponentByClass<UStatusEffectComponent>();
 	
 	switch (QuickHackType)
 	{
@@ -234,17 +296,9 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 			
 		case EQuickHackType::SystemFreeze:
 			// Immobilize target
-			if (PlayerAttributes)
+			if (PlayerAttributes && TargetEffects)
 			{
-				PlayerAttributes->bIsImmobilized = true;
-				
-				// Set timer to remove effect
-				FTimerHandle TimerHandle;
-				GetWorld()->GetTimerManager().SetTimer(TimerHandle, [PlayerAttributes]()
-				{
-					PlayerAttributes->bIsImmobilized = false;
-					UE_LOG(LogTemp, Warning, TEXT("SystemFreeze: Effect ended"));
-				}, EffectDuration, false);
+				TargetEffects->ApplyEffect(EStatusEffectType::SystemFreeze, EffectDuration);
 				
 				UE_LOG(LogTemp, Warning, TEXT("SystemFreeze: Target immobilized for %f seconds"), EffectDuration);
 			}
@@ -252,17 +306,9 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 			
 		case EQuickHackType::Firewall:
 			// Apply firewall protection
-			if (PlayerAttributes)
+			if (PlayerAttributes && TargetEffects)
 			{
-				PlayerAttributes->bHasFirewall = true;
-				
-				// Set timer to remove effect
-				FTimerHandle TimerHandle;
-				GetWorld()->GetTimerManager().SetTimer(TimerHandle, [PlayerAttributes]()
-				{
-					PlayerAttributes->bHasFirewall = false;
-					UE_LOG(LogTemp, Warning, TEXT("Firewall: Protection ended"));
-				}, EffectDuration, false);
+				TargetEffects->ApplyEffect(EStatusEffectType::Firewall, EffectDuration);
 				
 				UE_LOG(LogTemp, Warning, TEXT("Firewall: Protection active for %f seconds"), EffectDuration);
 			}
@@ -272,13 +318,13 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 			// Instantly kill the target enemy
 			{
 				ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(CurrentTarget);
-				if (Enemy)
+				UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(this);
+				if (Enemy && DamageQueue)
 				{
-					// Trigger death directly
-					UEnemyAttributeComponent* EnemyAttributes = Enemy->FindComponentByClass<UEnemyAttributeComponent>();
-					if (EnemyAttributes)
+					// Deal lethal damage
+					if (Enemy->GetEnemyAttributes())
 					{
-						EnemyAttributes->TakeDamage(100.0f); // Deal lethal damage
+						DamageQueue->QueueDamage(GetOwner(), Enemy, 100.0f, EDamageType::TrueDamage);
 						UE_LOG(LogTemp, Warning, TEXT("Kill QuickHack: Enemy eliminated"));
 					}
 				}
@@ -299,17 +345,9 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 			
 		case EQuickHackType::GhostProtocol:
 			// Make player invisible to hack enemies
-			if (PlayerAttributes)
+			if (PlayerAttributes && TargetEffects)
 			{
-				PlayerAttributes->bIsInvisibleToHackers = true;
-				
-				// Set timer to remove effect
-				FTimerHandle TimerHandle;
-				GetWorld()->GetTimerManager().SetTimer(TimerHandle, [PlayerAttributes]()
-				{
-					PlayerAttributes->bIsInvisibleToHackers = false;
-					UE_LOG(LogTemp, Warning, TEXT("Ghost Protocol: Effect ended"));
-				}, EffectDuration, false);
+				TargetEffects->ApplyEffect(EStatusEffectType::GhostProtocol, EffectDuration);
 				
 				UE_LOG(LogTemp, Warning, TEXT("Ghost Protocol: Player invisible to hackers for %f seconds"), EffectDuration);
 			}
@@ -321,14 +359,14 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 				ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(CurrentTarget);
 				if (Enemy)
 				{
-					UBlockAbilityComponent* BlockComp = Enemy->FindComponentByClass<UBlockAbilityComponent>();
+					UBlockAbilityComponent* BlockComp = Enemy->GetBlockAbility();
 					if (BlockComp)
 					{
 						BlockComp->CurrentBlockCharges = 0;
 						UE_LOG(LogTemp, Warning, TEXT("Charge Drain: Block charges depleted"));
 					}
 					
-					UDodgeAbilityComponent* DodgeComp = Enemy->FindComponentByClass<UDodgeAbilityComponent>();
+					UDodgeAbilityComponent* DodgeComp = Enemy->GetDodgeAbility();
 					if (DodgeComp)
 					{
 						DodgeComp->CurrentDodgeCharges = 0;
@@ -342,20 +380,9 @@ void UQuickHackComponent::ApplyQuickHackEffect()
 			// Reverse gravity for target
 			{
 				ACharacter* TargetChar = Cast<ACharacter>(CurrentTarget);
-				if (TargetChar && TargetChar->GetCharacterMovement())
+				if (TargetChar && TargetChar->GetCharacterMovement() && TargetEffects)
 				{
-					TargetChar->GetCharacterMovement()->GravityScale = -1.0f;
-					
-					// Set timer to restore gravity
-					FTimerHandle TimerHandle;
-					GetWorld()->GetTimerManager().SetTimer(TimerHandle, [TargetChar]()
-					{
-						if (TargetChar && TargetChar->GetCharacterMovement())
-						{
-							TargetChar->GetCharacterMovement()->GravityScale = 1.0f;
-							UE_LOG(LogTemp, Warning, TEXT("Gravity Flip: Effect ended"));
-						}
-					}, EffectDuration, false);
+					TargetEffects->ApplyEffect(EStatusEffectType::GravityFlip, EffectDuration);
 					
 					UE_LOG(LogTemp, Warning, TEXT("Gravity Flip: Target gravity reversed for %f seconds"), EffectDuration);
 				}
@@ -377,6 +404,11 @@ void UQuickHackComponent::OnEnemyKilled(AActor* KilledEnemy)
 	}
 }
 
+void UQuickHackComponent::HandleRegisteredEnemyKilled(ACybersoulsEnemyBase* KilledEnemy)
+{
+	OnEnemyKilled(KilledEnemy);
+}
+
 void UQuickHackComponent::MarkEnemyForCascade(AActor* Enemy)
 {
 	if (Enemy && !MarkedEnemies.Contains(Enemy))
@@ -389,9 +421,21 @@ void UQuickHackComponent::MarkEnemyForCascade(AActor* Enemy)
 		{
 			RemoveMarkFromEnemy(Enemy);
 		}, EffectDuration, false);
+		AddCascadeTimer(TimerHandle);
 	}
 }
 
+void UQuickHackComponent::AddCascadeTimer(const FTimerHandle& TimerHandle)
+{
+	// Drop handles of timers that already fired
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	CascadeTimers.RemoveAllSwap([&TimerManager](const FTimerHandle& Existing)
+	{
+		return !TimerManager.TimerExists(Existing);
+	});
+	CascadeTimers.Add(TimerHandle);
+}
+
 void UQuickHackComponent::RemoveMarkFromEnemy(AActor* Enemy)
 {
 	MarkedEnemies.Remove(Enemy);
@@ -411,19 +455,23 @@ void UQuickHackComponent::TriggerCascadeEffect(AActor* KilledEnemy)
 		if (EnemyBase && !EnemyBase->IsDead() && Enemy != KilledEnemy)
 		{
 			// Set timer to kill this enemy after 2 seconds
+			TWeakObjectPtr<ACybersoulsEnemyBase> WeakEnemy = EnemyBase;
+			TWeakObjectPtr<AActor> WeakOwner = GetOwner();
 			FTimerHandle TimerHandle;
-			GetWorld()->GetTimerManager().SetTimer(TimerHandle, [EnemyBase]()
+			GetWorld()->GetTimerManager().SetTimer(TimerHandle, [WeakEnemy, WeakOwner]()
 			{
-				if (EnemyBase && !EnemyBase->IsDead())
+				ACybersoulsEnemyBase* CascadeTarget = WeakEnemy.Get();
+				if (CascadeTarget && !CascadeTarget->IsDead())
 				{
-					UEnemyAttributeComponent* EnemyAttributes = EnemyBase->FindComponentByClass<UEnemyAttributeComponent>();
-					if (EnemyAttributes)
+					UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(CascadeTarget);
+					if (DamageQueue && CascadeTarget->GetEnemyAttributes())
 					{
-						EnemyAttributes->TakeDamage(100.0f);
+						DamageQueue->QueueDamage(WeakOwner.Get(), CascadeTarget, 100.0f, EDamageType::TrueDamage);
 						UE_LOG(LogTemp, Warning, TEXT("Cascade Virus: Delayed kill triggered"));
 					}
 				}
 			}, 2.0f, false);
+			AddCascadeTimer(TimerHandle);
 			
 			KillCount++;
 			UE_LOG(LogTemp, Warning, TEXT("Cascade Virus: Enemy marked for delayed death"));
@@ -436,22 +484,19 @@ TArray<AActor*> UQuickHackComponent::GetNearbyEnemies(AActor* CenterEnemy, float
 	TArray<AActor*> FoundEnemies;
 	if (!CenterEnemy) return FoundEnemies;
 	
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
+	UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	if (!Registry) return FoundEnemies;
 	
-	TArray<AActor*> IgnoreActors;
-	IgnoreActors.Add(GetOwner());
-	IgnoreActors.Add(CenterEnemy);
+	TArray<ACybersoulsEnemyBase*> NearbyEnemies;
+	Registry->QueryRadius(CenterEnemy->GetActorLocation(), Radius + CascadeTargetRadius, NearbyEnemies);
 	
-	UKismetSystemLibrary::SphereOverlapActors(
-		GetWorld(),
-		CenterEnemy->GetActorLocation(),
-		Radius,
-		ObjectTypes,
-		ACybersoulsEnemyBase::StaticClass(),
-		IgnoreActors,
-		FoundEnemies
-	);
+	for (ACybersoulsEnemyBase* Enemy : NearbyEnemies)
+	{
+		if (Enemy != CenterEnemy && Enemy != GetOwner())
+		{
+			FoundEnemies.Add(Enemy);
+		}
+	}
 	
 	return FoundEnemies;
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 // QuickHackManagerComponent.cpp
 #include "cybersouls/Public/Abilities/QuickHackManagerComponent.h"
 #include "cybersouls/Public/Abilities/PassiveAbilityComponent.h"
+#include "cybersouls/Public/Character/cybersoulsCharacter.h"
+#include "cybersouls/Public/SaveGame/CybersoulsSaveGame.h"
+#include "cybersouls/Public/SaveGame/CybersoulsSaveSubsystem.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
 
@@ -25,6 +28,7 @@ void UQuickHackManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
     
+    RestoreSavedQuickHacks();
     InitializeDefaultQuickHacks();
 }
 
@@ -67,6 +71,32 @@ void UQuickHackManagerComponent::InitializeDefaultQuickHacks()
     }
 }
 
+void UQuickHackManagerComponent::RestoreSavedQuickHacks()
+{
+    UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this);
+    const UCybersoulsSaveGame* SavedState = SaveSubsystem ? SaveSubsystem->GetProgressionState() : nullptr;
+    if (!SavedState)
+    {
+        return;
+    }
+    
+    // Applied directly rather than through UnlockQuickHack/SetQuickHackInSlot so nothing is journaled twice
+    for (EQuickHackType QuickHackType : SavedState->UnlockedQuickHacks)
+    {
+        AvailableQuickHacks.AddUnique(QuickHackType);
+    }
+    
+    const int32 NumSavedSlots = FMath::Min(SavedState->EquippedQuickHacks.Num(), MAX_QUICKHACK_SLOTS);
+    for (int32 i = 0; i < NumSavedSlots; i++)
+    {
+        const EQuickHackType QuickHackType = SavedState->EquippedQuickHacks[i];
+        if (QuickHackType != EQuickHackType::None && HasQuickHackAvailable(QuickHackType))
+        {
+            EquippedQuickHacks[i] = QuickHackType;
+        }
+    }
+}
+
 UQuickHackComponent* UQuickHackManagerComponent::CreateQuickHackInstance(EQuickHackType Type)
 {
     if (Type == EQuickHackType::None)
@@ -120,6 +150,10 @@ void UQuickHackManagerComponent::SetQuickHackInSlot(int32 SlotIndex, EQuickHackT
     
     // Set new QuickHack
     EquippedQuickHacks[ArrayIndex] = QuickHackType;
+    if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+    {
+        SaveSubsystem->RecordQuickHackEquipped(SlotIndex, QuickHackType);
+    }
     
     // Create new instance if not None
     if (QuickHackType != EQuickHackType::None)
@@ -147,6 +181,12 @@ void UQuickHackManagerComponent::SwapQuickHackSlots(int32 SlotA, int32 SlotB)
     UQuickHackComponent* TempInstance = QuickHackInstances[IndexA];
     QuickHackInstances[IndexA] = QuickHackInstances[IndexB];
     QuickHackInstances[IndexB] = TempInstance;
+    
+    if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+    {
+        SaveSubsystem->RecordQuickHackEquipped(SlotA, EquippedQuickHacks[IndexA]);
+        SaveSubsystem->RecordQuickHackEquipped(SlotB, EquippedQuickHacks[IndexB]);
+    }
 }
 
 bool UQuickHackManagerComponent::ActivateQuickHack(int32 SlotIndex)
@@ -165,9 +205,9 @@ bool UQuickHackManagerComponent::ActivateQuickHack(int32 SlotIndex)
     }
     
     // Check if SystemOvercharge passive is active (blocks all QuickHacks)
-    if (GetOwner())
+    if (AcybersoulsCharacter* OwnerCharacter = Cast<AcybersoulsCharacter>(GetOwner()))
     {
-        UPassiveAbilityComponent* PassiveComp = GetOwner()->FindComponentByClass<UPassiveAbilityComponent>();
+        UPassiveAbilityComponent* PassiveComp = OwnerCharacter->GetPassiveAbility();
         if (PassiveComp && PassiveComp->GetPassiveType() == EPassiveAbilityType::SystemOvercharge)
         {
             UE_LOG(LogTemp, Warning, TEXT("QuickHacks are disabled by System Overcharge passive"));
@@ -200,9 +240,9 @@ bool UQuickHackManagerComponent::CanActivateQuickHack(int32 SlotIndex) const
     }
     
     // Check if SystemOvercharge passive is active
-    if (GetOwner())
+    if (AcybersoulsCharacter* OwnerCharacter = Cast<AcybersoulsCharacter>(GetOwner()))
     {
-        UPassiveAbilityComponent* PassiveComp = GetOwner()->FindComponentByClass<UPassiveAbilityComponent>();
+        UPassiveAbilityComponent* PassiveComp = OwnerCharacter->GetPassiveAbility();
         if (PassiveComp && PassiveComp->GetPassiveType() == EPassiveAbilityType::SystemOvercharge)
         {
             return false;
@@ -212,6 +252,11 @@ bool UQuickHackManagerComponent::CanActivateQuickHack(int32 SlotIndex) const
     return QuickHack->CanActivateAbility();
 }
 
+UQuickHackComponent* UQuickHackManagerComponent::GetQuickHackInstance(int32 SlotIndex) const
+{
+    return IsValidSlot(SlotIndex) ? QuickHackInstances[SlotIndex - 1] : nullptr;
+}
+
 float UQuickHackManagerComponent::GetCooldownRemaining(int32 SlotIndex) const
 {
     if (!IsValidSlot(SlotIndex))
@@ -277,6 +322,10 @@ void UQuickHackManagerComponent::UnlockQuickHack(EQuickHackType QuickHackType)
     if (!HasQuickHackAvailable(QuickHackType))
     {
         AvailableQuickHacks.Add(QuickHackType);
+        if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+        {
+            SaveSubsystem->RecordQuickHackUnlocked(QuickHackType);
+        }
         UE_LOG(LogTemp, Log, TEXT("QuickHackManager: Unlocked %s"), 
             *UEnum::GetValueAsString(QuickHackType));
     }
@@ -6,9 +6,10 @@
 #include "cybersouls/Public/Abilities/PassiveAbilityComponent.h"
 #include "cybersouls/Public/Attributes/EnemyAttributeComponent.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "cybersouls/Public/Combat/DamageQueueSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
-#include "Kismet/KismetSystemLibrary.h"
 
 USlashAbilityComponent::USlashAbilityComponent()
 {
@@ -19,6 +20,23 @@ USlashAbilityComponent::USlashAbilityComponent()
 void USlashAbilityComponent::BeginPlay()
 {
 	Super::BeginPlay();
+	
+	// Kills are only known once queued damage resolves
+	if (UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(this))
+	{
+		DamageResolvedHandle = DamageQueue->OnDamageResolved.AddUObject(this, &USlashAbilityComponent::HandleDamageResolved);
+	}
+}
+
+void USlashAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(this))
+	{
+		DamageQueue->OnDamageResolved.Remove(DamageResolvedHandle);
+	}
+	DamageResolvedHandle.Reset();
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void USlashAbilityComponent::ActivateAbility()
@@ -51,6 +69,15 @@ void USlashAbilityComponent::PerformSlash()
 	
 	UE_LOG(LogTemp, Warning, TEXT("Slash: Found %d targets in range"), Targets.Num());
 	
+	PendingSlashTargets.Reset();
+	
+	// Check for passive abilities that might bypass defenses
+	AcybersoulsCharacter* PlayerChar = Cast<AcybersoulsCharacter>(GetOwner());
+	UPassiveAbilityComponent* PassiveComp = PlayerChar ? PlayerChar->GetPassiveAbility() : nullptr;
+	UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(this);
+	bool bIgnoreBlock = PassiveComp ? PassiveComp->ShouldIgnoreBlock() : false;
+	bool bIgnoreAllDefenses = PassiveComp ? PassiveComp->ShouldIgnoreAllDefenses() : false;
+	
 	for (AActor* Target : Targets)
 	{
 		ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(Target);
@@ -62,15 +89,10 @@ void USlashAbilityComponent::PerformSlash()
 		bool bWasBlocked = false;
 		bool bWasDodged = false;
 		
-		// Check for passive abilities that might bypass defenses
-		UPassiveAbilityComponent* PassiveComp = GetOwner()->FindComponentByClass<UPassiveAbilityComponent>();
-		bool bIgnoreBlock = PassiveComp ? PassiveComp->ShouldIgnoreBlock() : false;
-		bool bIgnoreAllDefenses = PassiveComp ? PassiveComp->ShouldIgnoreAllDefenses() : false;
-		
 		// Check for block ability (unless bypassed by passive)
 		if (!bIgnoreBlock && !bIgnoreAllDefenses)
 		{
-			UBlockAbilityComponent* BlockComp = Enemy->FindComponentByClass<UBlockAbilityComponent>();
+			UBlockAbilityComponent* BlockComp = Enemy->GetBlockAbility();
 			if (BlockComp && BlockComp->TryBlock(TargetedPart))
 			{
 				bWasBlocked = true;
@@ -81,7 +103,7 @@ void USlashAbilityComponent::PerformSlash()
 		// Check for dodge ability if not blocked (unless bypassed by passive)
 		if (!bWasBlocked && !bIgnoreAllDefenses)
 		{
-			UDodgeAbilityComponent* DodgeComp = Enemy->FindComponentByClass<UDodgeAbilityComponent>();
+			UDodgeAbilityComponent* DodgeComp = Enemy->GetDodgeAbility();
 			if (DodgeComp && DodgeComp->TryDodge(TargetedPart, GetOwner()))
 			{
 				bWasDodged = true;
@@ -89,26 +111,17 @@ void USlashAbilityComponent::PerformSlash()
 			}
 		}
 		
-		// Deal damage if not blocked or dodged
+		// Deal damage if not blocked or dodged; it lands when the damage queue resolves this frame
 		if (!bWasBlocked && !bWasDodged)
 		{
-			UEnemyAttributeComponent* EnemyAttributes = Enemy->FindComponentByClass<UEnemyAttributeComponent>();
-			if (EnemyAttributes)
+			UEnemyAttributeComponent* EnemyAttributes = Enemy->GetEnemyAttributes();
+			if (EnemyAttributes && DamageQueue)
 			{
-				bool bWasAlive = EnemyAttributes->GetIntegrity() > 0.0f;
+				DamageQueue->QueueDamage(GetOwner(), Enemy, SlashDamage, EDamageType::Physical, TargetedPart);
+				PendingSlashTargets.Add(Enemy);
 				UE_LOG(LogTemp, Warning, TEXT("Slash dealing %f damage to enemy with %f HP"), SlashDamage, EnemyAttributes->GetIntegrity());
-				EnemyAttributes->TakeDamage(SlashDamage);
-				
-				// Check if enemy was killed and notify passive abilities
-				bool bWasKilled = bWasAlive && (EnemyAttributes->GetIntegrity() <= 0.0f);
-				if (bWasKilled && PassiveComp)
-				{
-					PassiveComp->OnEnemyKilled();
-				}
-				
-				UE_LOG(LogTemp, Warning, TEXT("Slash hit enemy for %f damage! Enemy HP now: %f"), SlashDamage, EnemyAttributes->GetIntegrity());
 			}
-			else
+			else if (!EnemyAttributes)
 			{
 				UE_LOG(LogTemp, Error, TEXT("Enemy has no EnemyAttributeComponent!"));
 			}
@@ -116,25 +129,32 @@ void USlashAbilityComponent::PerformSlash()
 	}
 }
 
+void USlashAbilityComponent::HandleDamageResolved(AActor* Source, AActor* Target, float Damage, bool bKilled)
+{
+	if (Source != GetOwner() || PendingSlashTargets.Remove(Target) == 0 || !bKilled)
+	{
+		return;
+	}
+	
+	// Notify passive abilities of our kill
+	AcybersoulsCharacter* PlayerChar = Cast<AcybersoulsCharacter>(GetOwner());
+	if (UPassiveAbilityComponent* PassiveComp = PlayerChar ? PlayerChar->GetPassiveAbility() : nullptr)
+	{
+		PassiveComp->OnEnemyKilled();
+	}
+}
+
 TArray<AActor*> USlashAbilityComponent::GetTargetsInRange() const
 {
 	TArray<AActor*> FoundTargets;
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
 	
 	// Get all enemies in range
-	TArray<AActor*> IgnoreActors;
-	IgnoreActors.Add(GetOwner());
-	
-	UKismetSystemLibrary::SphereOverlapActors(
-		GetWorld(),
-		GetOwner()->GetActorLocation(),
-		SlashRange,
-		ObjectTypes,
-		ACybersoulsEnemyBase::StaticClass(),
-		IgnoreActors,
-		FoundTargets
-	);
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		TArray<ACybersoulsEnemyBase*> NearbyEnemies;
+		Registry->QueryRadius(GetOwner()->GetActorLocation(), SlashRange + SlashTargetRadius, NearbyEnemies);
+		FoundTargets.Append(NearbyEnemies);
+	}
 	
 	// Filter by crosshair target if we have one
 	AcybersoulsCharacter* PlayerChar = Cast<AcybersoulsCharacter>(GetOwner());
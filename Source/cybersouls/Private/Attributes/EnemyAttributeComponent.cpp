@@ -36,6 +36,11 @@ void UEnemyAttributeComponent::TakeDamage(float Damage)
 	CheckDeath();
 }
 
+void UEnemyAttributeComponent::ResetAttributes()
+{
+	Integrity = MaxIntegrity;
+}
+
 bool UEnemyAttributeComponent::IsAlive() const
 {
 	return Integrity > 0.0f;
@@ -62,6 +62,19 @@ void UPlayerAttributeComponent::RestoreIntegrity(float Amount)
 	}
 }
 
+void UPlayerAttributeComponent::ResetAttributes()
+{
+	Integrity = MaxIntegrity;
+	HackProgress = 0.0f;
+	bCanUseAbilities = true;
+	bIsImmobilized = false;
+	bHasFirewall = false;
+	bIsInvisibleToHackers = false;
+	
+	OnIntegrityChanged.Broadcast(Integrity);
+	OnHackProgressChanged.Broadcast(HackProgress);
+}
+
 bool UPlayerAttributeComponent::IsAlive() const
 {
 	return HackProgress < MaxHackProgress;
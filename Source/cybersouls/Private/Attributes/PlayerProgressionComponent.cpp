@@ -2,6 +2,7 @@
 
 #include "cybersouls/Public/Attributes/PlayerProgressionComponent.h"
 #include "cybersouls/Public/SaveGame/CybersoulsSaveGame.h"
+#include "cybersouls/Public/SaveGame/CybersoulsSaveSubsystem.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -37,6 +38,10 @@ void UPlayerProgressionComponent::AddIntegrityXP(float Amount)
 	if (Amount > 0.0f)
 	{
 		IntegrityXP += Amount;
+		if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+		{
+			SaveSubsystem->RecordIntegrityXP(Amount);
+		}
 		OnIntegrityXPChanged.Broadcast(IntegrityXP);
 		UE_LOG(LogTemp, Log, TEXT("Gained %f Integrity XP. Total: %f"), Amount, IntegrityXP);
 	}
@@ -47,6 +52,10 @@ void UPlayerProgressionComponent::AddHackingXP(float Amount)
 	if (Amount > 0.0f)
 	{
 		HackingXP += Amount;
+		if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+		{
+			SaveSubsystem->RecordHackingXP(Amount);
+		}
 		OnHackingXPChanged.Broadcast(HackingXP);
 		UE_LOG(LogTemp, Log, TEXT("Gained %f Hacking XP. Total: %f"), Amount, HackingXP);
 	}
@@ -61,6 +70,25 @@ void UPlayerProgressionComponent::SaveProgression()
 		return;
 	}
 	
+	// Gains are already journaled, saving just folds them into a snapshot
+	if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+	{
+		// Catch values set directly rather than through AddIntegrityXP/AddHackingXP
+		const UCybersoulsSaveGame* State = SaveSubsystem->GetProgressionState();
+		if (State && !FMath::IsNearlyEqual(State->IntegrityXP, IntegrityXP))
+		{
+			SaveSubsystem->RecordIntegrityXP(IntegrityXP - State->IntegrityXP);
+		}
+		if (State && !FMath::IsNearlyEqual(State->HackingXP, HackingXP))
+		{
+			SaveSubsystem->RecordHackingXP(HackingXP - State->HackingXP);
+		}
+
+		SaveSubsystem->CompactProgression();
+		UE_LOG(LogTemp, Log, TEXT("[XP SAVE] Progression save queued - Integrity XP: %f, Hacking XP: %f"), IntegrityXP, HackingXP);
+		return;
+	}
+	
 	// Create or get existing save game object
 	UCybersoulsSaveGame* SaveGameInstance = Cast<UCybersoulsSaveGame>(UGameplayStatics::CreateSaveGameObject(UCybersoulsSaveGame::StaticClass()));
 	
@@ -70,7 +98,6 @@ void UPlayerProgressionComponent::SaveProgression()
 		SaveGameInstance->IntegrityXP = FMath::Max(0.0f, IntegrityXP);
 		SaveGameInstance->HackingXP = FMath::Max(0.0f, HackingXP);
 		
-		// Save to disk
 		if (UGameplayStatics::SaveGameToSlot(SaveGameInstance, UCybersoulsSaveGame::SaveSlotName, UCybersoulsSaveGame::UserIndex))
 		{
 			UE_LOG(LogTemp, Warning, TEXT("[XP SAVE] Progression saved successfully - Integrity XP: %f, Hacking XP: %f"), IntegrityXP, HackingXP);
@@ -88,8 +115,15 @@ void UPlayerProgressionComponent::SaveProgression()
 
 void UPlayerProgressionComponent::LoadProgression()
 {
+	// Snapshot plus journal, newer than the save slot on disk
+	UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this);
+	const UCybersoulsSaveGame* LoadGameInstance = SaveSubsystem ? SaveSubsystem->GetProgressionState() : nullptr;
+	
 	// Try to load existing save game
-	UCybersoulsSaveGame* LoadGameInstance = Cast<UCybersoulsSaveGame>(UGameplayStatics::LoadGameFromSlot(UCybersoulsSaveGame::SaveSlotName, UCybersoulsSaveGame::UserIndex));
+	if (!LoadGameInstance)
+	{
+		LoadGameInstance = Cast<UCybersoulsSaveGame>(UGameplayStatics::LoadGameFromSlot(UCybersoulsSaveGame::SaveSlotName, UCybersoulsSaveGame::UserIndex));
+	}
 	
 	if (LoadGameInstance)
 	{
@@ -120,6 +154,10 @@ void UPlayerProgressionComponent::ResetProgression()
 {
 	IntegrityXP = 0.0f;
 	HackingXP = 0.0f;
+	if (UCybersoulsSaveSubsystem* SaveSubsystem = UCybersoulsSaveSubsystem::Get(this))
+	{
+		SaveSubsystem->RecordProgressionReset();
+	}
 	OnIntegrityXPChanged.Broadcast(IntegrityXP);
 	OnHackingXPChanged.Broadcast(HackingXP);
 	UE_LOG(LogTemp, Warning, TEXT("Progression reset to zero"));
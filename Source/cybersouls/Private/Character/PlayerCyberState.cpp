@@ -47,12 +47,12 @@ void APlayerCyberState::PossessedBy(AController* NewController)
 {
     Super::PossessedBy(NewController);
     
-    // Add Input Mapping Context when possessed
+    // Add Input Mapping Context when possessed, ACyberSoulsPlayerController keeps it registered across switches
     if (APlayerController* PlayerController = Cast<APlayerController>(NewController))
     {
         if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
         {
-            if (CyberStateMappingContext)
+            if (CyberStateMappingContext && !Subsystem->HasMappingContext(CyberStateMappingContext))
             {
                 UE_LOG(LogTemp, Warning, TEXT("PlayerCyberState: Adding CyberStateMappingContext on possession"));
                 Subsystem->AddMappingContext(CyberStateMappingContext, 0);
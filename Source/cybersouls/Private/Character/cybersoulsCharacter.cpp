@@ -18,6 +18,7 @@
 #include "cybersouls/Public/Abilities/PassiveAbilityComponent.h"
 #include "cybersouls/Public/Abilities/BaseAbilityComponent.h"
 #include "cybersouls/Public/Combat/BodyPartComponent.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
 #include "cybersouls/Public/Components/TargetingComponent.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
 #include "cybersouls/Public/Player/CyberSoulsPlayerController.h"
@@ -74,6 +75,7 @@ AcybersoulsCharacter::AcybersoulsCharacter()
 	SlashAbility = CreateDefaultSubobject<USlashAbilityComponent>(TEXT("SlashAbility"));
 	QuickHackManager = CreateDefaultSubobject<UQuickHackManagerComponent>(TEXT("QuickHackManager"));
 	TargetingComponent = CreateDefaultSubobject<UTargetingComponent>(TEXT("TargetingComponent"));
+	StatusEffects = CreateDefaultSubobject<UStatusEffectComponent>(TEXT("StatusEffects"));
 }
 
 void AcybersoulsCharacter::BeginPlay()
@@ -81,6 +83,8 @@ void AcybersoulsCharacter::BeginPlay()
 	// Call the base class  
 	Super::BeginPlay();
 	
+	CachedPassiveAbility = FindComponentByClass<UPassiveAbilityComponent>();
+	
 	// Bind player death to game mode
 	if (PlayerAttributes)
 	{
@@ -103,12 +107,12 @@ void AcybersoulsCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 	
-	// Add Input Mapping Context when possessed
+	// Add Input Mapping Context when possessed, ACyberSoulsPlayerController keeps it registered across switches
 	if (APlayerController* PlayerController = Cast<APlayerController>(NewController))
 	{
 		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
 		{
-			if (DefaultMappingContext)
+			if (DefaultMappingContext && !Subsystem->HasMappingContext(DefaultMappingContext))
 			{
 				UE_LOG(LogTemp, Warning, TEXT("cybersoulsCharacter: Adding DefaultMappingContext on possession"));
 				Subsystem->AddMappingContext(DefaultMappingContext, 0);
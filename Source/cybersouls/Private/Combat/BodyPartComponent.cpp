@@ -1,5 +1,60 @@
 // BodyPartComponent.cpp
 #include "cybersouls/Public/Combat/BodyPartComponent.h"
+#include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "AnimationRuntime.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+	// Used for bones without physics bodies
+	constexpr float DefaultBoneRadius = 15.0f;
+
+	// Map a bone to a body part by name. Handles the usual "_l"/"_r" and "left"/"right" conventions.
+	// Arms are left out: spread in an A or T pose they would stretch the upper body zone over the legs.
+	EBodyPart ClassifyBone(const FName BoneName)
+	{
+		const FString Name = BoneName.ToString().ToLower();
+
+		const bool bIsLegBone = Name.Contains(TEXT("thigh")) || Name.Contains(TEXT("calf")) || Name.Contains(TEXT("foot"))
+			|| Name.Contains(TEXT("leg")) || Name.Contains(TEXT("knee")) || Name.Contains(TEXT("shin")) || Name.Contains(TEXT("ball"));
+		if (bIsLegBone)
+		{
+			if (Name.EndsWith(TEXT("_l")) || Name.Contains(TEXT("_l_")) || Name.Contains(TEXT("left")))
+			{
+				return EBodyPart::LeftLeg;
+			}
+			if (Name.EndsWith(TEXT("_r")) || Name.Contains(TEXT("_r_")) || Name.Contains(TEXT("right")))
+			{
+				return EBodyPart::RightLeg;
+			}
+			return EBodyPart::None;
+		}
+
+		const bool bIsUpperBone = Name.Contains(TEXT("pelvis")) || Name.Contains(TEXT("spine")) || Name.Contains(TEXT("chest"))
+			|| Name.Contains(TEXT("neck")) || Name.Contains(TEXT("head"));
+		return bIsUpperBone ? EBodyPart::UpperBody : EBodyPart::None;
+	}
+
+	// Mesh-space fallback boxes around the offsets body parts used to be placed at
+	FBox GetDefaultPartBounds(EBodyPart Part)
+	{
+		switch (Part)
+		{
+			case EBodyPart::UpperBody:
+				return FBox(FVector(-35.0f, -35.0f, 85.0f), FVector(35.0f, 35.0f, 160.0f));
+			case EBodyPart::LeftLeg:
+				return FBox(FVector(-20.0f, -50.0f, 0.0f), FVector(20.0f, -10.0f, 80.0f));
+			case EBodyPart::RightLeg:
+				return FBox(FVector(-20.0f, 10.0f, 0.0f), FVector(20.0f, 50.0f, 80.0f));
+			default:
+				return FBox(ForceInit);
+		}
+	}
+}
 
 UBodyPartComponent::UBodyPartComponent()
 {
@@ -9,4 +64,141 @@ UBodyPartComponent::UBodyPartComponent()
 void UBodyPartComponent::BeginPlay()
 {
 	Super::BeginPlay();
+}
+
+const FBodyPartZone* FBodyPartZoneTable::FindZone(EBodyPart Part) const
+{
+	for (const FBodyPartZone& Zone : Zones)
+	{
+		if (Zone.Part == Part)
+		{
+			return &Zone;
+		}
+	}
+	return nullptr;
+}
+
+EBodyPart FBodyPartZoneTable::Resolve(const FVector& LocalPoint) const
+{
+	EBodyPart BestPart = EBodyPart::None;
+	double BestDistance = TNumericLimits<double>::Max();
+
+	for (const FBodyPartZone& Zone : Zones)
+	{
+		// Signed distance to the capsule surface; negative means inside
+		const double Distance = FMath::PointDistToSegment(LocalPoint, Zone.Start, Zone.End) - Zone.Radius;
+		if (Distance < BestDistance)
+		{
+			BestDistance = Distance;
+			BestPart = Zone.Part;
+		}
+	}
+
+	return BestPart;
+}
+
+const FBodyPartZoneTable& FBodyPartZoneTable::FindOrBake(const ACharacter* Character)
+{
+	static TMap<FObjectKey, TUniquePtr<FBodyPartZoneTable>> BakedTables;
+
+	const FObjectKey ArchetypeKey(Character ? Character->GetClass() : nullptr);
+	if (const TUniquePtr<FBodyPartZoneTable>* Existing = BakedTables.Find(ArchetypeKey))
+	{
+		return **Existing;
+	}
+
+	TUniquePtr<FBodyPartZoneTable>& Table = BakedTables.Add(ArchetypeKey, MakeUnique<FBodyPartZoneTable>(Bake(Character)));
+	return *Table;
+}
+
+FBodyPartZoneTable FBodyPartZoneTable::Bake(const ACharacter* Character)
+{
+	const USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+	const USkeletalMesh* SkeletalMesh = Mesh ? Mesh->GetSkeletalMeshAsset() : nullptr;
+	const FTransform MeshToActor = Mesh ? Mesh->GetRelativeTransform() : FTransform::Identity;
+
+	// Actor-space bounds per part, indexed by EBodyPart
+	FBox PartBounds[4] = { FBox(ForceInit), FBox(ForceInit), FBox(ForceInit), FBox(ForceInit) };
+
+	if (SkeletalMesh)
+	{
+		const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+		const UPhysicsAsset* PhysicsAsset = SkeletalMesh->GetPhysicsAsset();
+
+		if (PhysicsAsset && PhysicsAsset->SkeletalBodySetups.Num() > 0)
+		{
+			// Physics bodies give real volumes
+			for (const USkeletalBodySetup* Body : PhysicsAsset->SkeletalBodySetups)
+			{
+				const int32 BoneIndex = Body ? RefSkeleton.FindBoneIndex(Body->BoneName) : INDEX_NONE;
+				const EBodyPart Part = Body ? ClassifyBone(Body->BoneName) : EBodyPart::None;
+				if (BoneIndex == INDEX_NONE || Part == EBodyPart::None)
+				{
+					continue;
+				}
+
+				const FTransform BoneToActor = FAnimationRuntime::GetComponentSpaceTransformRefPose(RefSkeleton, BoneIndex) * MeshToActor;
+				PartBounds[static_cast<uint8>(Part)] += Body->AggGeom.CalcAABB(BoneToActor);
+			}
+		}
+		else
+		{
+			// No physics asset, pad the bone positions instead
+			for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+			{
+				const EBodyPart Part = ClassifyBone(RefSkeleton.GetBoneName(BoneIndex));
+				if (Part == EBodyPart::None)
+				{
+					continue;
+				}
+
+				const FVector BoneLocation = MeshToActor.TransformPosition(FAnimationRuntime::GetComponentSpaceTransformRefPose(RefSkeleton, BoneIndex).GetLocation());
+				PartBounds[static_cast<uint8>(Part)] += FBox::BuildAABB(BoneLocation, FVector(DefaultBoneRadius));
+			}
+		}
+	}
+
+	FBodyPartZoneTable Table;
+	const EBodyPart Parts[] = { EBodyPart::UpperBody, EBodyPart::LeftLeg, EBodyPart::RightLeg };
+	for (EBodyPart Part : Parts)
+	{
+		Table.AddZone(Part, PartBounds[static_cast<uint8>(Part)]);
+	}
+
+	// Nothing usable in the mesh, keep the old default layout rather than leave the character unhittable
+	if (Table.Zones.Num() == 0)
+	{
+		for (EBodyPart Part : Parts)
+		{
+			Table.AddZone(Part, GetDefaultPartBounds(Part).TransformBy(MeshToActor));
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BodyPartZones: Baked %d zones for %s (%s)"), Table.Zones.Num(),
+		Character ? *Character->GetClass()->GetName() : TEXT("None"),
+		SkeletalMesh ? *SkeletalMesh->GetName() : TEXT("no mesh"));
+
+	return Table;
+}
+
+void FBodyPartZoneTable::AddZone(EBodyPart Part, const FBox& ActorSpaceBounds)
+{
+	if (Zones.Num() >= MaxZones || !ActorSpaceBounds.IsValid)
+	{
+		return;
+	}
+
+	// Vertical capsule inscribed in the bounds, so the narrower side sets the radius
+	const FVector Center = ActorSpaceBounds.GetCenter();
+	const FVector Extent = ActorSpaceBounds.GetExtent();
+	const double Radius = FMath::Max(FMath::Min(Extent.X, Extent.Y), 1.0);
+	const double HalfSegment = FMath::Max(Extent.Z - Radius, 0.0);
+
+	FBodyPartZone& Zone = Zones.AddDefaulted_GetRef();
+	Zone.Part = Part;
+	Zone.Start = Center - FVector(0.0f, 0.0f, HalfSegment);
+	Zone.End = Center + FVector(0.0f, 0.0f, HalfSegment);
+	Zone.Radius = static_cast<float>(Radius);
+
+	PartMask |= PartBit(Part);
 }
\ No newline at end of file
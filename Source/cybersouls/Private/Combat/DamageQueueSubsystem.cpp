@@ -0,0 +1,164 @@
+// DamageQueueSubsystem.cpp
+#include "cybersouls/Public/Combat/DamageQueueSubsystem.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Character/cybersoulsCharacter.h"
+#include "cybersouls/Public/Attributes/EnemyAttributeComponent.h"
+#include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+DECLARE_CYCLE_STAT(TEXT("Damage Resolve"), STAT_DamageResolve, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events"), STAT_DamageEvents, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damaged Targets"), STAT_DamagedTargets, STATGROUP_Cybersouls);
+
+UDamageQueueSubsystem* UDamageQueueSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UDamageQueueSubsystem>() : nullptr;
+}
+
+void UDamageQueueSubsystem::Deinitialize()
+{
+	PendingEvents.Empty();
+	TargetTotals.Empty();
+	TargetIndices.Empty();
+	OnDamageResolved.Clear();
+
+	Super::Deinitialize();
+}
+
+void UDamageQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ResolvePendingDamage();
+}
+
+TStatId UDamageQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamageQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UDamageQueueSubsystem::QueueDamage(AActor* Source, AActor* Target, float Amount, EDamageType DamageType, EBodyPart BodyPart)
+{
+	if (!IsValid(Target) || Amount <= 0.0f)
+	{
+		return;
+	}
+
+	FQueuedDamageEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.Source = Source;
+	Event.Target = Target;
+	Event.BodyPart = BodyPart;
+	Event.Amount = Amount;
+	Event.DamageType = DamageType;
+
+	INC_DWORD_STAT(STAT_DamageEvents);
+}
+
+void UDamageQueueSubsystem::DiscardPendingDamage()
+{
+	PendingEvents.Reset();
+}
+
+void UDamageQueueSubsystem::ResolvePendingDamage()
+{
+	if (PendingEvents.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_DamageResolve);
+
+	// Take the queue so hits caused by deaths below land in the next pass
+	TArray<FQueuedDamageEvent> Events = MoveTemp(PendingEvents);
+	PendingEvents.Reset();
+
+	// Sum hits per target, keeping targets in the order they were first hit
+	TargetTotals.Reset();
+	TargetIndices.Reset();
+	for (const FQueuedDamageEvent& Event : Events)
+	{
+		AActor* Target = Event.Target.Get();
+		if (!IsValid(Target))
+		{
+			continue;
+		}
+
+		int32* ExistingIndex = TargetIndices.Find(Target);
+		FTargetDamage& Damage = ExistingIndex ? TargetTotals[*ExistingIndex] : TargetTotals.AddDefaulted_GetRef();
+		if (!ExistingIndex)
+		{
+			Damage.Target = Target;
+			Damage.Receiver.Reset(Target);
+			TargetIndices.Add(Target, TargetTotals.Num() - 1);
+		}
+
+		Damage.Total += ApplyResistance(Damage, Event.Amount, Event.DamageType);
+		Damage.LastSource = Event.Source.Get();
+		if (Event.BodyPart != EBodyPart::None)
+		{
+			Damage.LastBodyPart = Event.BodyPart;
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_DamagedTargets, TargetTotals.Num());
+
+	for (const FTargetDamage& Damage : TargetTotals)
+	{
+		// An earlier target's death may have destroyed this one
+		if (!IsValid(Damage.Target) || Damage.Total <= 0.0f)
+		{
+			continue;
+		}
+
+		const bool bKilled = ApplyTotalDamage(Damage);
+		OnDamageResolved.Broadcast(Damage.LastSource, Damage.Target, Damage.Total, bKilled);
+	}
+}
+
+float UDamageQueueSubsystem::ApplyResistance(const FTargetDamage& Damage, float Amount, EDamageType DamageType) const
+{
+	if (DamageType == EDamageType::TrueDamage || !Damage.Receiver.Implements())
+	{
+		return Amount;
+	}
+
+	return Amount * IDamageReceiver::DispatchGetDamageResistance(Damage.Receiver, DamageType);
+}
+
+bool UDamageQueueSubsystem::ApplyTotalDamage(const FTargetDamage& Damage)
+{
+	if (ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(Damage.Target))
+	{
+		UEnemyAttributeComponent* EnemyAttributes = Enemy->GetEnemyAttributes();
+		if (Enemy->IsDead() || !EnemyAttributes || !EnemyAttributes->IsAlive())
+		{
+			return false;
+		}
+
+		// One integrity change, one OnDamaged broadcast and one death check
+		EnemyAttributes->TakeDamage(Damage.Total);
+		Enemy->OnReceivedDamage(Damage.Total, Damage.LastBodyPart);
+		return !EnemyAttributes->IsAlive();
+	}
+
+	if (AcybersoulsCharacter* PlayerCharacter = Cast<AcybersoulsCharacter>(Damage.Target))
+	{
+		if (UPlayerAttributeComponent* PlayerAttributes = PlayerCharacter->GetPlayerAttributes())
+		{
+			PlayerAttributes->TakeDamage(Damage.Total);
+		}
+
+		// Integrity loss never kills the player
+		return false;
+	}
+
+	return false;
+}
@@ -0,0 +1,267 @@
+// StatusEffectComponent.cpp
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
+#include "cybersouls/Public/Combat/StatusEffectSubsystem.h"
+#include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
+#include "cybersouls/Public/Abilities/PassiveAbilityComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+
+UStatusEffectComponent::UStatusEffectComponent()
+{
+	// Expiry is driven by UStatusEffectSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UStatusEffectComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (AActor* Owner = GetOwner())
+	{
+		PlayerAttributes = Owner->FindComponentByClass<UPlayerAttributeComponent>();
+
+		if (ACharacter* OwnerCharacter = Cast<ACharacter>(Owner))
+		{
+			CharacterMovement = OwnerCharacter->GetCharacterMovement();
+		}
+	}
+}
+
+void UStatusEffectComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ClearAllEffects();
+
+	if (UStatusEffectSubsystem* Subsystem = UStatusEffectSubsystem::Get(this))
+	{
+		Subsystem->UnregisterComponent(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UStatusEffectComponent::ApplyEffect(EStatusEffectType Type, float Duration, EStatusEffectStackRule StackRule, int32 MaxStacks)
+{
+	UWorld* World = GetWorld();
+	if (!World || Type == EStatusEffectType::None || Duration <= 0.0f)
+	{
+		return false;
+	}
+
+	const double Now = World->GetTimeSeconds();
+
+	const int32 ExistingIndex = FindEffectIndex(Type);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		FActiveStatusEffect& Effect = ActiveEffects[ExistingIndex];
+		switch (StackRule)
+		{
+			case EStatusEffectStackRule::Extend:
+				Effect.ExpireTime += Duration;
+				break;
+			case EStatusEffectStackRule::Stack:
+				Effect.StackCount = FMath::Min(Effect.StackCount + 1, FMath::Max(MaxStacks, 1));
+				Effect.ExpireTime = FMath::Max(Effect.ExpireTime, Now + Duration);
+				break;
+			case EStatusEffectStackRule::Refresh:
+			default:
+				Effect.ExpireTime = FMath::Max(Effect.ExpireTime, Now + Duration);
+				break;
+		}
+		return true;
+	}
+
+	if (ActiveEffects.Num() >= MaxActiveEffects)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StatusEffects: %s has no free slot for effect %d"),
+			GetOwner() ? *GetOwner()->GetName() : TEXT("Unknown"), static_cast<int32>(Type));
+		return false;
+	}
+
+	FActiveStatusEffect& Effect = ActiveEffects.AddDefaulted_GetRef();
+	Effect.Type = Type;
+	Effect.ExpireTime = Now + Duration;
+	StartEffect(Effect);
+
+	// First effect: join the batched expiry pass
+	if (ActiveEffects.Num() == 1)
+	{
+		if (UStatusEffectSubsystem* Subsystem = UStatusEffectSubsystem::Get(this))
+		{
+			Subsystem->RegisterComponent(this);
+		}
+	}
+
+	OnStatusEffectChanged.Broadcast(this, Type, true);
+	return true;
+}
+
+bool UStatusEffectComponent::RemoveEffect(EStatusEffectType Type)
+{
+	const int32 Index = FindEffectIndex(Type);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	RemoveEffectAt(Index);
+	return true;
+}
+
+void UStatusEffectComponent::ClearAllEffects()
+{
+	while (ActiveEffects.Num() > 0)
+	{
+		RemoveEffectAt(ActiveEffects.Num() - 1);
+	}
+}
+
+float UStatusEffectComponent::GetRemainingTime(EStatusEffectType Type) const
+{
+	const int32 Index = FindEffectIndex(Type);
+	const UWorld* World = GetWorld();
+	if (Index == INDEX_NONE || !World)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Max(0.0f, static_cast<float>(ActiveEffects[Index].ExpireTime - World->GetTimeSeconds()));
+}
+
+int32 UStatusEffectComponent::GetStackCount(EStatusEffectType Type) const
+{
+	const int32 Index = FindEffectIndex(Type);
+	return Index != INDEX_NONE ? ActiveEffects[Index].StackCount : 0;
+}
+
+void UStatusEffectComponent::ExpireEffects(double Now)
+{
+	for (int32 Index = ActiveEffects.Num() - 1; Index >= 0; --Index)
+	{
+		// Listeners may have removed effects while we were walking the array
+		if (ActiveEffects.IsValidIndex(Index) && ActiveEffects[Index].ExpireTime <= Now)
+		{
+			RemoveEffectAt(Index);
+		}
+	}
+}
+
+int32 UStatusEffectComponent::FindEffectIndex(EStatusEffectType Type) const
+{
+	for (int32 Index = 0; Index < ActiveEffects.Num(); ++Index)
+	{
+		if (ActiveEffects[Index].Type == Type)
+		{
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UStatusEffectComponent::RemoveEffectAt(int32 Index)
+{
+	const FActiveStatusEffect Effect = ActiveEffects[Index];
+	ActiveEffects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	EndEffect(Effect);
+	OnStatusEffectChanged.Broadcast(this, Effect.Type, false);
+}
+
+void UStatusEffectComponent::StartEffect(FActiveStatusEffect& Effect)
+{
+	switch (Effect.Type)
+	{
+		case EStatusEffectType::SystemFreeze:
+			if (PlayerAttributes)
+			{
+				PlayerAttributes->bIsImmobilized = true;
+			}
+			break;
+
+		case EStatusEffectType::Firewall:
+			if (PlayerAttributes)
+			{
+				PlayerAttributes->bHasFirewall = true;
+			}
+			break;
+
+		case EStatusEffectType::GhostProtocol:
+			if (PlayerAttributes)
+			{
+				PlayerAttributes->bIsInvisibleToHackers = true;
+			}
+			break;
+
+		case EStatusEffectType::GravityFlip:
+			if (CharacterMovement)
+			{
+				Effect.SavedValue = CharacterMovement->GravityScale;
+				CharacterMovement->GravityScale = -1.0f;
+			}
+			break;
+
+		case EStatusEffectType::ExecutionChains:
+			// Passives are added by blueprints and may begin play after us, so resolve on first use
+			if (!PassiveAbility && GetOwner())
+			{
+				PassiveAbility = GetOwner()->FindComponentByClass<UPassiveAbilityComponent>();
+			}
+			if (PassiveAbility)
+			{
+				PassiveAbility->bExecutionChainsActive = true;
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+void UStatusEffectComponent::EndEffect(const FActiveStatusEffect& Effect)
+{
+	switch (Effect.Type)
+	{
+		case EStatusEffectType::SystemFreeze:
+			if (PlayerAttributes)
+			{
+				PlayerAttributes->bIsImmobilized = false;
+				UE_LOG(LogTemp, Warning, TEXT("SystemFreeze: Effect ended"));
+			}
+			break;
+
+		case EStatusEffectType::Firewall:
+			if (PlayerAttributes)
+			{
+				PlayerAttributes->bHasFirewall = false;
+				UE_LOG(LogTemp, Warning, TEXT("Firewall: Protection ended"));
+			}
+			break;
+
+		case EStatusEffectType::GhostProtocol:
+			if (PlayerAttributes)
+			{
+				PlayerAttributes->bIsInvisibleToHackers = false;
+				UE_LOG(LogTemp, Warning, TEXT("Ghost Protocol: Effect ended"));
+			}
+			break;
+
+		case EStatusEffectType::GravityFlip:
+			if (CharacterMovement)
+			{
+				CharacterMovement->GravityScale = Effect.SavedValue;
+				UE_LOG(LogTemp, Warning, TEXT("Gravity Flip: Effect ended"));
+			}
+			break;
+
+		case EStatusEffectType::ExecutionChains:
+			if (PassiveAbility)
+			{
+				PassiveAbility->bExecutionChainsActive = false;
+				UE_LOG(LogTemp, Warning, TEXT("Execution Chains: Deactivated"));
+			}
+			break;
+
+		default:
+			break;
+	}
+}
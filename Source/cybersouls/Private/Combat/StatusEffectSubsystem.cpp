@@ -0,0 +1,79 @@
+// StatusEffectSubsystem.cpp
+#include "cybersouls/Public/Combat/StatusEffectSubsystem.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+DECLARE_CYCLE_STAT(TEXT("Status Effect Pass"), STAT_StatusEffectPass, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effect Holders"), STAT_StatusEffectHolders, STATGROUP_Cybersouls);
+
+UStatusEffectSubsystem* UStatusEffectSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr;
+}
+
+void UStatusEffectSubsystem::Deinitialize()
+{
+	ActiveComponents.Empty();
+
+	Super::Deinitialize();
+}
+
+void UStatusEffectSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_StatusEffectPass);
+	SET_DWORD_STAT(STAT_StatusEffectHolders, ActiveComponents.Num());
+
+	if (ActiveComponents.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Effects ending can apply or clear effects elsewhere, so walk a snapshot
+	TArray<UStatusEffectComponent*, TInlineAllocator<32>> Components(ActiveComponents);
+	for (UStatusEffectComponent* Component : Components)
+	{
+		if (IsValid(Component))
+		{
+			Component->ExpireEffects(Now);
+		}
+	}
+
+	// Drop holders that have nothing left to expire
+	for (int32 Index = ActiveComponents.Num() - 1; Index >= 0; --Index)
+	{
+		if (!IsValid(ActiveComponents[Index]) || !ActiveComponents[Index]->HasActiveEffects())
+		{
+			ActiveComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+TStatId UStatusEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStatusEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UStatusEffectSubsystem::RegisterComponent(UStatusEffectComponent* Component)
+{
+	if (IsValid(Component))
+	{
+		ActiveComponents.AddUnique(Component);
+	}
+}
+
+void UStatusEffectSubsystem::UnregisterComponent(UStatusEffectComponent* Component)
+{
+	ActiveComponents.RemoveSingleSwap(Component, EAllowShrinking::No);
+}
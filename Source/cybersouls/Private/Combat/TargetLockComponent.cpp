@@ -1,10 +1,15 @@
 // TargetLockComponent.cpp
 #include "cybersouls/Public/Combat/TargetLockComponent.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "cybersouls/Public/AI/AILineOfSightSubsystem.h"
+#include "cybersouls/cybersouls.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 
+DECLARE_CYCLE_STAT(TEXT("Target Lock Candidate Refresh"), STAT_TargetLockRefresh, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Target Lock Candidates"), STAT_TargetLockCandidates, STATGROUP_Cybersouls);
+
 UTargetLockComponent::UTargetLockComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -19,11 +24,17 @@ void UTargetLockComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// Update lock validity
-	if (CurrentTarget)
+	// Lock upkeep runs at LockValidityInterval, not every frame
+	if (CurrentTarget && GetWorld()->GetTimeSeconds() - LastValidityCheckTime >= LockValidityInterval)
 	{
 		UpdateLockValidity();
 	}
+
+	// Keep the candidate set warm while locked so switching never waits on a rebuild
+	if (CurrentTarget)
+	{
+		RefreshCandidates();
+	}
 }
 
 void UTargetLockComponent::ToggleTargetLock()
@@ -37,7 +48,7 @@ void UTargetLockComponent::ToggleTargetLock()
 		AActor* BestTarget = FindBestTarget();
 		if (BestTarget)
 		{
-			LockTarget(BestTarget);
+			SetLockedTarget(BestTarget);
 		}
 	}
 }
@@ -49,8 +60,19 @@ void UTargetLockComponent::LockTarget(AActor* Target)
 		return;
 	}
 
+	SetLockedTarget(Target);
+}
+
+void UTargetLockComponent::SetLockedTarget(AActor* Target)
+{
 	CurrentTarget = Target;
 	TargetedBodyPart = EBodyPart::UpperBody;
+	LastValidityCheckTime = GetWorld()->GetTimeSeconds();
+	LastTargetVisibleTime = LastValidityCheckTime;
+	CurrentCandidateIndex = Candidates.IndexOfByPredicate([Target](const FLockCandidate& Candidate)
+	{
+		return Candidate.Actor.Get() == Target;
+	});
 
 	OnTargetLocked.Broadcast(CurrentTarget, TargetedBodyPart);
 }
@@ -60,39 +82,40 @@ void UTargetLockComponent::UnlockTarget()
 	if (CurrentTarget)
 	{
 		CurrentTarget = nullptr;
+		CurrentCandidateIndex = INDEX_NONE;
 		OnTargetUnlocked.Broadcast();
 	}
 }
 
 void UTargetLockComponent::ChangeTargetLeft()
 {
-	TArray<AActor*> ValidTargets = GetValidTargets();
-	if (ValidTargets.Num() <= 1)
-	{
-		return;
-	}
-
-	int32 CurrentIndex = ValidTargets.IndexOfByKey(CurrentTarget);
-	if (CurrentIndex != INDEX_NONE)
-	{
-		int32 NewIndex = (CurrentIndex - 1 + ValidTargets.Num()) % ValidTargets.Num();
-		LockTarget(ValidTargets[NewIndex]);
-	}
+	CycleTarget(-1);
 }
 
 void UTargetLockComponent::ChangeTargetRight()
 {
-	TArray<AActor*> ValidTargets = GetValidTargets();
-	if (ValidTargets.Num() <= 1)
+	CycleTarget(1);
+}
+
+void UTargetLockComponent::CycleTarget(int32 Direction)
+{
+	RefreshCandidates();
+
+	const int32 NumCandidates = Candidates.Num();
+	if (NumCandidates <= 1 || CurrentCandidateIndex == INDEX_NONE)
 	{
 		return;
 	}
 
-	int32 CurrentIndex = ValidTargets.IndexOfByKey(CurrentTarget);
-	if (CurrentIndex != INDEX_NONE)
+	// Walk past candidates that died since the last refresh
+	for (int32 Step = 1; Step < NumCandidates; ++Step)
 	{
-		int32 NewIndex = (CurrentIndex + 1) % ValidTargets.Num();
-		LockTarget(ValidTargets[NewIndex]);
+		const int32 NewIndex = (CurrentCandidateIndex + Direction * Step + NumCandidates * Step) % NumCandidates;
+		if (AActor* NewTarget = Candidates[NewIndex].Actor.Get())
+		{
+			SetLockedTarget(NewTarget);
+			return;
+		}
 	}
 }
 
@@ -103,106 +126,161 @@ void UTargetLockComponent::ChangeBodyPart(EBodyPart NewBodyPart)
 		return;
 	}
 
-	UBodyPartComponent* BodyPart = GetBodyPartComponent(CurrentTarget, NewBodyPart);
-	if (BodyPart && BodyPart->CanBeTargeted())
+	// Enemies answer from their baked hit zones; anything else still needs a component scan
+	bool bCanTarget = false;
+	if (const ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(CurrentTarget))
+	{
+		bCanTarget = Enemy->HasBodyPart(NewBodyPart);
+	}
+	else
+	{
+		UBodyPartComponent* BodyPart = GetBodyPartComponent(CurrentTarget, NewBodyPart);
+		bCanTarget = BodyPart && BodyPart->CanBeTargeted();
+	}
+
+	if (bCanTarget)
 	{
 		TargetedBodyPart = NewBodyPart;
 		OnTargetLocked.Broadcast(CurrentTarget, TargetedBodyPart);
 	}
 }
 
-AActor* UTargetLockComponent::FindBestTarget() const
+AActor* UTargetLockComponent::FindBestTarget()
 {
-	TArray<AActor*> ValidTargets = GetValidTargets();
-	if (ValidTargets.Num() == 0)
+	RefreshCandidates();
+
+	return Candidates.IsValidIndex(BestCandidateIndex) ? Candidates[BestCandidateIndex].Actor.Get() : nullptr;
+}
+
+void UTargetLockComponent::RefreshCandidates()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (LastCandidateRefreshTime >= 0.0 && Now - LastCandidateRefreshTime < CandidateRefreshInterval)
 	{
-		return nullptr;
+		return;
 	}
+	LastCandidateRefreshTime = Now;
 
-	AActor* BestTarget = nullptr;
-	float BestScore = -1.0f;
+	SCOPE_CYCLE_COUNTER(STAT_TargetLockRefresh);
 
+	Candidates.Reset();
+	CurrentCandidateIndex = INDEX_NONE;
+	BestCandidateIndex = INDEX_NONE;
+
+	UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
 	APawn* OwnerPawn = Cast<APawn>(GetOwner());
-	if (!OwnerPawn)
+	if (!EnemyClass || !Registry || !OwnerPawn)
 	{
-		return nullptr;
+		SET_DWORD_STAT(STAT_TargetLockCandidates, 0);
+		return;
 	}
 
-	FVector OwnerLocation = OwnerPawn->GetActorLocation();
-	FVector OwnerForward = OwnerPawn->GetActorForwardVector();
+	const FVector OwnerLocation = OwnerPawn->GetActorLocation();
+	const FVector OwnerForward = OwnerPawn->GetActorForwardVector();
+	const FVector OwnerRight = OwnerPawn->GetActorRightVector();
 
-	for (AActor* Target : ValidTargets)
-	{
-		FVector ToTarget = Target->GetActorLocation() - OwnerLocation;
-		float Distance = ToTarget.Size();
-		ToTarget.Normalize();
+	// The cone query already applies the distance and angle limits
+	TArray<ACybersoulsEnemyBase*> Enemies;
+	Registry->QueryCone(OwnerLocation, OwnerForward, MaxLockDistance, MaxLockAngle, Enemies);
 
-		float DotProduct = FVector::DotProduct(OwnerForward, ToTarget);
-		float AngleScore = (DotProduct + 1.0f) * 0.5f; // Convert to 0-1 range
-		float DistanceScore = 1.0f - (Distance / MaxLockDistance);
+	UAILineOfSightSubsystem* LineOfSight = UAILineOfSightSubsystem::Get(this);
 
-		float Score = (AngleScore * 0.7f) + (DistanceScore * 0.3f);
+	for (ACybersoulsEnemyBase* Enemy : Enemies)
+	{
+		if (!Enemy->IsA(EnemyClass) || Enemy->IsDead() || Enemy->IsActorBeingDestroyed())
+		{
+			continue;
+		}
 
-		if (Score > BestScore)
+		const FVector EnemyLocation = Enemy->GetActorLocation();
+		const bool bVisible = LineOfSight
+			? LineOfSight->HasLineOfSight(OwnerPawn, Enemy, OwnerLocation, EnemyLocation, MaxCandidateLineOfSightAge)
+			: IsValidTarget(Enemy);
+		if (!bVisible)
 		{
-			BestScore = Score;
-			BestTarget = Target;
+			continue;
 		}
-	}
 
-	return BestTarget;
-}
+		// Keys are computed once here so switching and sorting never touch vectors
+		const FVector ToEnemy = EnemyLocation - OwnerLocation;
+		const float ForwardDot = FVector::DotProduct(OwnerForward, ToEnemy);
+		const float RightDot = FVector::DotProduct(OwnerRight, ToEnemy);
+		const float Distance = ToEnemy.Size();
 
-TArray<AActor*> UTargetLockComponent::GetValidTargets() const
-{
-	TArray<AActor*> ValidTargets;
+		FLockCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+		Candidate.Actor = Enemy;
+		Candidate.AngleKey = FMath::RadiansToDegrees(FMath::Atan2(RightDot, ForwardDot));
 
-	if (!EnemyClass)
-	{
-		return ValidTargets;
+		const float AngleScore = Distance > KINDA_SMALL_NUMBER ? (ForwardDot / Distance + 1.0f) * 0.5f : 1.0f; // Convert to 0-1 range
+		const float DistanceScore = 1.0f - (Distance / MaxLockDistance);
+		Candidate.Score = (AngleScore * 0.7f) + (DistanceScore * 0.3f);
 	}
 
-	TArray<AActor*> AllEnemies;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), EnemyClass, AllEnemies);
+	// Sort by angle from left to right
+	Candidates.Sort([](const FLockCandidate& A, const FLockCandidate& B)
+	{
+		return A.AngleKey < B.AngleKey;
+	});
 
-	for (AActor* Enemy : AllEnemies)
+	float BestScore = -1.0f;
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
 	{
-		if (IsValidTarget(Enemy))
+		const FLockCandidate& Candidate = Candidates[Index];
+		if (Candidate.Score > BestScore)
+		{
+			BestScore = Candidate.Score;
+			BestCandidateIndex = Index;
+		}
+		if (CurrentTarget && Candidate.Actor.Get() == CurrentTarget)
 		{
-			ValidTargets.Add(Enemy);
+			CurrentCandidateIndex = Index;
 		}
 	}
 
-	// Sort by angle from left to right
-	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	SET_DWORD_STAT(STAT_TargetLockCandidates, Candidates.Num());
+}
+
+bool UTargetLockComponent::IsValidTarget(AActor* Target) const
+{
+	if (!IsWithinLockCone(Target))
 	{
-		FVector OwnerLocation = OwnerPawn->GetActorLocation();
-		FVector OwnerRight = OwnerPawn->GetActorRightVector();
+		return false;
+	}
 
-		ValidTargets.Sort([&](const AActor& A, const AActor& B)
-		{
-			FVector ToA = A.GetActorLocation() - OwnerLocation;
-			FVector ToB = B.GetActorLocation() - OwnerLocation;
-			ToA.Normalize();
-			ToB.Normalize();
+	APawn* OwnerPawn = Cast<APawn>(GetOwner());
 
-			float DotA = FVector::DotProduct(OwnerRight, ToA);
-			float DotB = FVector::DotProduct(OwnerRight, ToB);
+	// Check line of sight
+	FHitResult HitResult;
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(OwnerPawn);
+	QueryParams.AddIgnoredActor(Target);
 
-			return DotA < DotB;
-		});
-	}
+	bool bHit = GetWorld()->LineTraceSingleByChannel(
+		HitResult,
+		OwnerPawn->GetActorLocation(),
+		Target->GetActorLocation(),
+		ECC_Visibility,
+		QueryParams
+	);
 
-	return ValidTargets;
+	return !bHit;
 }
 
-bool UTargetLockComponent::IsValidTarget(AActor* Target) const
+bool UTargetLockComponent::IsWithinLockCone(AActor* Target) const
 {
 	if (!Target || !Target->IsValidLowLevel() || Target->IsActorBeingDestroyed())
 	{
 		return false;
 	}
 
+	if (const ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(Target))
+	{
+		if (Enemy->IsDead())
+		{
+			return false;
+		}
+	}
+
 	APawn* OwnerPawn = Cast<APawn>(GetOwner());
 	if (!OwnerPawn)
 	{
@@ -210,41 +288,54 @@ bool UTargetLockComponent::IsValidTarget(AActor* Target) const
 	}
 
 	// Check distance
-	float Distance = FVector::Dist(OwnerPawn->GetActorLocation(), Target->GetActorLocation());
-	if (Distance > MaxLockDistance)
+	const FVector ToTarget = Target->GetActorLocation() - OwnerPawn->GetActorLocation();
+	const float DistSquared = ToTarget.SizeSquared();
+	if (DistSquared > FMath::Square(MaxLockDistance))
 	{
 		return false;
 	}
 
-	// Check angle
-	FVector ToTarget = Target->GetActorLocation() - OwnerPawn->GetActorLocation();
-	ToTarget.Normalize();
-	float Angle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(OwnerPawn->GetActorForwardVector(), ToTarget)));
-	if (Angle > MaxLockAngle)
+	// Check angle, comparing Dot / |ToTarget| against the cone cosine without a square root
+	if (LockAngleCosineSource != MaxLockAngle)
 	{
-		return false;
+		LockAngleCosineSource = MaxLockAngle;
+		LockAngleCosine = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(MaxLockAngle, 0.0f, 180.0f)));
 	}
 
-	// Check line of sight
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwnerPawn);
-	QueryParams.AddIgnoredActor(Target);
-
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		OwnerPawn->GetActorLocation(),
-		Target->GetActorLocation(),
-		ECC_Visibility,
-		QueryParams
-	);
-
-	return !bHit;
+	const float Dot = FVector::DotProduct(OwnerPawn->GetActorForwardVector(), ToTarget);
+	const float CosSquared = FMath::Square(LockAngleCosine);
+	if (LockAngleCosine >= 0.0f)
+	{
+		return Dot >= 0.0f && FMath::Square(Dot) >= CosSquared * DistSquared;
+	}
+	return Dot >= 0.0f || FMath::Square(Dot) <= CosSquared * DistSquared;
 }
 
 void UTargetLockComponent::UpdateLockValidity()
 {
-	if (!IsValidTarget(CurrentTarget))
+	const double Now = GetWorld()->GetTimeSeconds();
+	LastValidityCheckTime = Now;
+
+	// Leaving range or dying drops the lock straight away
+	if (!IsWithinLockCone(CurrentTarget))
+	{
+		UnlockTarget();
+		return;
+	}
+
+	// Occlusion is read from the batched async traces and only drops the lock once it
+	// has lasted OcclusionGraceTime, so thin cover and single-frame misses are ignored
+	APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	UAILineOfSightSubsystem* LineOfSight = UAILineOfSightSubsystem::Get(this);
+	const bool bVisible = LineOfSight
+		? LineOfSight->HasLineOfSight(OwnerPawn, CurrentTarget, OwnerPawn->GetActorLocation(), CurrentTarget->GetActorLocation(), LockValidityInterval * 2.0f)
+		: IsValidTarget(CurrentTarget);
+
+	if (bVisible)
+	{
+		LastTargetVisibleTime = Now;
+	}
+	else if (Now - LastTargetVisibleTime > OcclusionGraceTime)
 	{
 		UnlockTarget();
 	}
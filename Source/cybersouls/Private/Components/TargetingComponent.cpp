@@ -1,11 +1,17 @@
 #include "cybersouls/Public/Components/TargetingComponent.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
 #include "cybersouls/Public/Interfaces/ITargetable.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
+#include "UnrealClient.h"
+
+DECLARE_CYCLE_STAT(TEXT("Crosshair Targeting"), STAT_CrosshairTargeting, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crosshair Traces"), STAT_CrosshairTraces, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crosshair Traces Skipped"), STAT_CrosshairTracesSkipped, STATGROUP_Cybersouls);
 
 UTargetingComponent::UTargetingComponent()
 {
@@ -24,6 +30,21 @@ void UTargetingComponent::BeginPlay()
     {
         CameraComponent = GetOwner()->FindComponentByClass<UCameraComponent>();
     }
+
+    ViewportResizedHandle = FViewport::ViewportResizedEvent.AddUObject(this, &UTargetingComponent::OnViewportResized);
+}
+
+void UTargetingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+    ViewportResizedHandle.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UTargetingComponent::OnViewportResized(FViewport* Viewport, uint32 Unused)
+{
+    bScreenCenterValid = false;
 }
 
 void UTargetingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -34,20 +55,32 @@ void UTargetingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 
 void UTargetingComponent::UpdateTargeting()
 {
+    SCOPE_CYCLE_COUNTER(STAT_CrosshairTargeting);
+
+    if (!NeedsRetrace())
+    {
+        INC_DWORD_STAT(STAT_CrosshairTracesSkipped);
+        return;
+    }
+    INC_DWORD_STAT(STAT_CrosshairTraces);
+
     AActor* PreviousTarget = CurrentTarget;
     EBodyPart PreviousBodyPart = CurrentBodyPart;
 
     // Perform crosshair trace
-    FHitResult HitResult = PerformCrosshairTrace();
+    FHitResult HitResult;
+    FVector RayStart, RayEnd;
+    const bool bTraced = TraceCrosshair(HitResult, RayStart, RayEnd);
 
     if (HitResult.bBlockingHit)
     {
         AActor* HitActor = HitResult.GetActor();
         
         // Check if the hit actor implements ITargetable
-        if (HitActor && HitActor->GetClass()->ImplementsInterface(UTargetable::StaticClass()))
+        const TCachedInterface<ITargetable>& Targetable = ResolveTargetable(HitActor);
+        if (Targetable.Implements())
         {
-            if (ITargetable::Execute_CanBeTargeted(HitActor))
+            if (ITargetable::DispatchCanBeTargeted(Targetable))
             {
                 CurrentTarget = HitActor;
                 DetermineBodyPart(HitResult);
@@ -76,6 +109,25 @@ void UTargetingComponent::UpdateTargeting()
         CurrentBodyPart = EBodyPart::None;
     }
 
+    // Remember what this trace saw so unchanged frames can skip the next one
+    bHasTraceSnapshot = bTraced;
+    if (bTraced)
+    {
+        LastTraceTime = GetWorld()->GetTimeSeconds();
+        LastCameraLocation = CameraComponent->GetComponentLocation();
+        LastCameraRotation = CameraComponent->GetComponentQuat();
+        LastRayStart = RayStart;
+        LastRayEnd = RayEnd;
+        LastTargetLocation = CurrentTarget ? CurrentTarget->GetActorLocation() : FVector::ZeroVector;
+
+        GatherEnemiesNearRay(RayStart, RayEnd);
+        NearbyEnemySnapshot.Reset(NearbyEnemyScratch.Num());
+        for (ACybersoulsEnemyBase* Enemy : NearbyEnemyScratch)
+        {
+            NearbyEnemySnapshot.Add({ Enemy, Enemy->GetActorLocation() });
+        }
+    }
+
     // Fire events if changed
     if (CurrentTarget != PreviousTarget)
     {
@@ -87,20 +139,95 @@ void UTargetingComponent::UpdateTargeting()
     }
 }
 
+bool UTargetingComponent::NeedsRetrace()
+{
+    if (!bHasTraceSnapshot || !bScreenCenterValid || !CameraComponent)
+    {
+        return true;
+    }
+
+    if (GetWorld()->GetTimeSeconds() - LastTraceTime >= MaxTraceInterval)
+    {
+        return true;
+    }
+
+    if (!CameraComponent->GetComponentLocation().Equals(LastCameraLocation, CameraMoveTolerance)
+        || !CameraComponent->GetComponentQuat().Equals(LastCameraRotation, CameraRotationTolerance))
+    {
+        return true;
+    }
+
+    if (CurrentTarget && (!IsValid(CurrentTarget)
+        || !CurrentTarget->GetActorLocation().Equals(LastTargetLocation, EnemyMoveTolerance)))
+    {
+        return true;
+    }
+
+    // Anything that entered, left or moved along the ray could change the hit
+    GatherEnemiesNearRay(LastRayStart, LastRayEnd);
+    if (NearbyEnemyScratch.Num() != NearbyEnemySnapshot.Num())
+    {
+        return true;
+    }
+
+    for (const ACybersoulsEnemyBase* Enemy : NearbyEnemyScratch)
+    {
+        const FNearbyEnemySnapshot* Snapshot = NearbyEnemySnapshot.FindByPredicate([Enemy](const FNearbyEnemySnapshot& Entry)
+        {
+            return Entry.Enemy.Get() == Enemy;
+        });
+
+        if (!Snapshot || !Enemy->GetActorLocation().Equals(Snapshot->Location, EnemyMoveTolerance))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UTargetingComponent::GatherEnemiesNearRay(const FVector& RayStart, const FVector& RayEnd)
+{
+    NearbyEnemyScratch.Reset();
+
+    UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
+
+    FBox RayBounds(ForceInit);
+    RayBounds += RayStart;
+    RayBounds += RayEnd;
+    Registry->QueryBox(RayBounds.ExpandBy(NearbyEnemyRadius), NearbyEnemyScratch);
+
+    const float RadiusSquared = FMath::Square(NearbyEnemyRadius);
+    NearbyEnemyScratch.RemoveAllSwap([&](const ACybersoulsEnemyBase* Enemy)
+    {
+        return FMath::PointDistToSegmentSquared(Enemy->GetActorLocation(), RayStart, RayEnd) > RadiusSquared;
+    }, EAllowShrinking::No);
+}
+
 FHitResult UTargetingComponent::PerformCrosshairTrace() const
 {
     FHitResult HitResult;
+    FVector RayStart, RayEnd;
+    TraceCrosshair(HitResult, RayStart, RayEnd);
+    return HitResult;
+}
 
+bool UTargetingComponent::TraceCrosshair(FHitResult& OutHit, FVector& OutRayStart, FVector& OutRayEnd) const
+{
     APawn* OwnerPawn = Cast<APawn>(GetOwner());
     if (!OwnerPawn)
     {
-        return HitResult;
+        return false;
     }
 
     APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
     if (!PC || !CameraComponent)
     {
-        return HitResult;
+        return false;
     }
 
     // Get screen center
@@ -114,26 +241,30 @@ FHitResult UTargetingComponent::PerformCrosshairTrace() const
         FVector TraceStart = CameraComponent->GetComponentLocation();
         FVector TraceEnd = TraceStart + (WorldDirection * MaxTargetingRange);
 
-        FCollisionQueryParams TraceParams;
-        TraceParams.AddIgnoredActor(GetOwner());
-        TraceParams.bTraceComplex = true;
+        // Simple collision is enough to pick a target, body parts come from the baked hit zones
+        FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(CrosshairTrace), false, GetOwner());
+
+        GetWorld()->LineTraceSingleByChannel(OutHit, TraceStart, TraceEnd, TraceChannel, TraceParams);
 
-        GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, TraceChannel, TraceParams);
+        OutRayStart = TraceStart;
+        OutRayEnd = OutHit.bBlockingHit ? OutHit.Location : TraceEnd;
 
         // Debug visualization
         if (bDebugDrawTrace)
         {
             DrawDebugLine(GetWorld(), TraceStart, TraceEnd, 
-                HitResult.bBlockingHit ? FColor::Red : FColor::Green, false, 0.1f);
+                OutHit.bBlockingHit ? FColor::Red : FColor::Green, false, 0.1f);
             
-            if (HitResult.bBlockingHit)
+            if (OutHit.bBlockingHit)
             {
-                DrawDebugSphere(GetWorld(), HitResult.Location, 10.0f, 12, FColor::Red, false, 0.1f);
+                DrawDebugSphere(GetWorld(), OutHit.Location, 10.0f, 12, FColor::Red, false, 0.1f);
             }
         }
+
+        return true;
     }
 
-    return HitResult;
+    return false;
 }
 
 bool UTargetingComponent::IsTargetValid(AActor* Target) const
@@ -144,9 +275,10 @@ bool UTargetingComponent::IsTargetValid(AActor* Target) const
     }
 
     // Check if implements ITargetable
-    if (Target->GetClass()->ImplementsInterface(UTargetable::StaticClass()))
+    const TCachedInterface<ITargetable>& Targetable = ResolveTargetable(Target);
+    if (Targetable.Implements())
     {
-        return ITargetable::Execute_CanBeTargeted(Target);
+        return ITargetable::DispatchCanBeTargeted(Targetable);
     }
 
     // Legacy check for enemies
@@ -163,47 +295,48 @@ void UTargetingComponent::DetermineBodyPart(const FHitResult& HitResult)
     }
 
     // If actor implements ITargetable, use its method
-    if (HitActor->GetClass()->ImplementsInterface(UTargetable::StaticClass()))
+    const TCachedInterface<ITargetable>& Targetable = ResolveTargetable(HitActor);
+    if (Targetable.Implements())
     {
-        CurrentBodyPart = ITargetable::Execute_GetTargetBodyPart(HitActor, HitResult.Location);
+        CurrentBodyPart = ITargetable::DispatchGetTargetBodyPart(Targetable, HitResult.Location);
         return;
     }
 
-    // Legacy body part determination
-    FVector HitLocation = HitResult.Location;
-    FVector ActorLocation = HitActor->GetActorLocation();
-    FVector Origin, BoxExtent;
-    HitActor->GetActorBounds(false, Origin, BoxExtent);
-
-    // Determine body part based on hit height relative to actor
-    float RelativeHeight = HitLocation.Z - ActorLocation.Z;
-    
-    if (RelativeHeight > BoxExtent.Z * 0.3f)
+    // Legacy enemies resolve against their archetype's baked hit zones
+    if (const ACybersoulsEnemyBase* Enemy = Cast<ACybersoulsEnemyBase>(HitActor))
     {
-        CurrentBodyPart = EBodyPart::UpperBody;
+        CurrentBodyPart = Enemy->ResolveBodyPart(HitResult.Location);
+        return;
     }
-    else
+
+    CurrentBodyPart = EBodyPart::None;
+}
+
+const TCachedInterface<ITargetable>& UTargetingComponent::ResolveTargetable(AActor* Actor) const
+{
+    // The crosshair usually stays on one actor for many frames, so only resolve on change
+    if (!TargetableHandle.IsFor(Actor))
     {
-        // Determine left or right leg based on Y position
-        float RelativeY = HitLocation.Y - ActorLocation.Y;
-        if (RelativeY > 0)
-        {
-            CurrentBodyPart = EBodyPart::RightLeg;
-        }
-        else
-        {
-            CurrentBodyPart = EBodyPart::LeftLeg;
-        }
+        TargetableHandle.Reset(Actor);
     }
+    return TargetableHandle;
 }
 
 FVector2D UTargetingComponent::GetScreenCenter() const
 {
+    // Only changes when the viewport is resized, see OnViewportResized
+    if (bScreenCenterValid)
+    {
+        return CachedScreenCenter;
+    }
+
     if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
     {
         int32 ViewportSizeX, ViewportSizeY;
         PC->GetViewportSize(ViewportSizeX, ViewportSizeY);
-        return FVector2D(ViewportSizeX * 0.5f, ViewportSizeY * 0.5f);
+        CachedScreenCenter = FVector2D(ViewportSizeX * 0.5f, ViewportSizeY * 0.5f);
+        bScreenCenterValid = ViewportSizeX > 0 && ViewportSizeY > 0;
+        return CachedScreenCenter;
     }
     return FVector2D::ZeroVector;
 }
\ No newline at end of file
@@ -35,6 +35,17 @@ void ACybersoulsBuffNetrunner::BeginPlay()
 	}
 }
 
+void ACybersoulsBuffNetrunner::ResetForReuse()
+{
+	Super::ResetForReuse();
+	
+	// Hacking resumes on reuse just like it starts in BeginPlay
+	if (HackAbility)
+	{
+		HackAbility->ActivateAbility();
+	}
+}
+
 void ACybersoulsBuffNetrunner::InitializeEnemy()
 {
 	Super::InitializeEnemy();
@@ -37,6 +37,17 @@ void ACybersoulsDebuffNetrunner::BeginPlay()
 	}
 }
 
+void ACybersoulsDebuffNetrunner::ResetForReuse()
+{
+	Super::ResetForReuse();
+	
+	// Hacking resumes on reuse just like it starts in BeginPlay
+	if (HackAbility)
+	{
+		HackAbility->ActivateAbility();
+	}
+}
+
 void ACybersoulsDebuffNetrunner::InitializeEnemy()
 {
 	Super::InitializeEnemy();
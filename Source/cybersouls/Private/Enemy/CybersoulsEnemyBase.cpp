@@ -1,9 +1,20 @@
 // CybersoulsEnemyBase.cpp
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "cybersouls/Public/Enemy/DebrisPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/EnemyPoolSubsystem.h"
 #include "cybersouls/Public/AI/PhysicalEnemyAIController.h"
 #include "cybersouls/Public/AI/HackingEnemyAIController.h"
 #include "cybersouls/Public/Game/cybersoulsGameMode.h"
+#include "cybersouls/Public/Attributes/PhysicalEnemyAttributeComponent.h"
+#include "cybersouls/Public/Attributes/HackingEnemyAttributeComponent.h"
+#include "cybersouls/Public/Abilities/BaseAbilityComponent.h"
+#include "cybersouls/Public/Abilities/AttackAbilityComponent.h"
+#include "cybersouls/Public/Abilities/BlockAbilityComponent.h"
+#include "cybersouls/Public/Abilities/DodgeAbilityComponent.h"
+#include "cybersouls/Public/Abilities/HackAbilityComponent.h"
 #include "cybersouls/Public/Abilities/QuickHackComponent.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -12,6 +23,11 @@
 #include "TimerManager.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
+#include "cybersouls/cybersouls.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Component Lookups"), STAT_EnemyComponentLookups, STATGROUP_Cybersouls);
+
+int32 ACybersoulsEnemyBase::NumComponentLookups = 0;
 
 ACybersoulsEnemyBase::ACybersoulsEnemyBase()
 {
@@ -32,6 +48,8 @@ ACybersoulsEnemyBase::ACybersoulsEnemyBase()
 	RightLegPart->SetupAttachment(GetMesh());
 	RightLegPart->BodyPartType = EBodyPart::RightLeg;
 	
+	StatusEffects = CreateDefaultSubobject<UStatusEffectComponent>(TEXT("StatusEffects"));
+	
 	// Set default AI controller based on enemy type
 	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
 	
@@ -60,15 +78,16 @@ void ACybersoulsEnemyBase::BeginPlay()
 	// Start behavior timers
 	StartBehaviorTimers();
 	
-	// Register with game mode for quest tracking
-	AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
-	if (IsValid(GameMode))
+	// Make sure a shatter of this archetype never has to create pieces
+	if (UDebrisPoolSubsystem* DebrisPool = UDebrisPoolSubsystem::Get(this))
 	{
-		if (AcybersoulsGameMode* CybersoulsGameMode = Cast<AcybersoulsGameMode>(GameMode))
-		{
-			CybersoulsGameMode->RegisterEnemy(this);
-			UE_LOG(LogTemp, Warning, TEXT("Enemy %s registered with GameMode"), *GetName());
-		}
+		DebrisPool->PrewarmPieces(ShatterPieceMesh, ShatterPieceCount);
+	}
+	
+	// Register with the enemy registry (quest tracking reads from it too)
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEnemy(this);
 	}
 	
 	// Log AI controller setup
@@ -83,25 +102,80 @@ void ACybersoulsEnemyBase::BeginPlay()
 	}
 }
 
+void ACybersoulsEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterEnemy(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ACybersoulsEnemyBase::InitializeEnemy()
 {
+	CacheComponents();
 	SetupBodyParts();
 	SetupAttributesForType();
 	SetupAbilitiesForType();
 }
 
+template<typename T>
+T* ACybersoulsEnemyBase::LookupComponent()
+{
+	++NumComponentLookups;
+	INC_DWORD_STAT(STAT_EnemyComponentLookups);
+	return FindComponentByClass<T>();
+}
+
+void ACybersoulsEnemyBase::CacheComponents()
+{
+	CachedEnemyAttributes = LookupComponent<UEnemyAttributeComponent>();
+	CachedPhysicalAttributes = Cast<UPhysicalEnemyAttributeComponent>(CachedEnemyAttributes);
+	CachedHackingAttributes = Cast<UHackingEnemyAttributeComponent>(CachedEnemyAttributes);
+	CachedAttackAbility = LookupComponent<UAttackAbilityComponent>();
+	CachedBlockAbility = LookupComponent<UBlockAbilityComponent>();
+	CachedDodgeAbility = LookupComponent<UDodgeAbilityComponent>();
+	CachedHackAbility = LookupComponent<UHackAbilityComponent>();
+
+	CachedQuickHacks.Reset();
+	GetComponents<UQuickHackComponent>(CachedQuickHacks);
+	++NumComponentLookups;
+	INC_DWORD_STAT(STAT_EnemyComponentLookups);
+}
+
 void ACybersoulsEnemyBase::SetupBodyParts()
 {
-	// Set body part positions based on mesh
+	// Place body part components at the centers of the baked hit zones
 	if (GetMesh())
 	{
-		// Upper body at chest height
-		UpperBodyPart->SetRelativeLocation(FVector(0.0f, 0.0f, 120.0f));
-		
-		// Legs at lower positions
-		LeftLegPart->SetRelativeLocation(FVector(0.0f, -30.0f, 40.0f));
-		RightLegPart->SetRelativeLocation(FVector(0.0f, 30.0f, 40.0f));
+		const FBodyPartZoneTable& Zones = GetBodyPartZones();
+		const FTransform& MeshToActor = GetMesh()->GetRelativeTransform();
+
+		UBodyPartComponent* Parts[] = { UpperBodyPart, LeftLegPart, RightLegPart };
+		for (UBodyPartComponent* Part : Parts)
+		{
+			const FBodyPartZone* Zone = Part ? Zones.FindZone(Part->BodyPartType) : nullptr;
+			if (Zone)
+			{
+				Part->SetRelativeLocation(MeshToActor.InverseTransformPosition(Zone->GetCenter()));
+			}
+		}
+	}
+}
+
+const FBodyPartZoneTable& ACybersoulsEnemyBase::GetBodyPartZones() const
+{
+	if (!BodyPartZones)
+	{
+		BodyPartZones = &FBodyPartZoneTable::FindOrBake(this);
 	}
+	return *BodyPartZones;
+}
+
+EBodyPart ACybersoulsEnemyBase::ResolveBodyPart(const FVector& WorldLocation) const
+{
+	return GetBodyPartZones().Resolve(GetActorTransform().InverseTransformPosition(WorldLocation));
 }
 
 void ACybersoulsEnemyBase::SetupAttributesForType()
@@ -150,6 +224,13 @@ void ACybersoulsEnemyBase::OnDeath()
 
 	bIsDead = true;
 
+	// Leave the registry first so the game mode sees the updated count, and
+	// let QuickHackComponents react for Cascade Virus
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->NotifyEnemyKilled(this);
+	}
+
 	// Notify game mode of death for quest tracking
 	AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
 	if (IsValid(GameMode))
@@ -159,17 +240,6 @@ void ACybersoulsEnemyBase::OnDeath()
 			CybersoulsGameMode->OnEnemyDeath(this);
 		}
 	}
-	
-	// Notify all QuickHackComponents about this enemy death for Cascade Virus
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), FoundActors);
-	for (AActor* Actor : FoundActors)
-	{
-		if (UQuickHackComponent* QuickHackComp = Actor->FindComponentByClass<UQuickHackComponent>())
-		{
-			QuickHackComp->OnEnemyKilled(this);
-		}
-	}
 
 	// Stop all timers
 	GetWorldTimerManager().ClearTimer(AttackTimerHandle);
@@ -194,13 +264,155 @@ void ACybersoulsEnemyBase::StartDeathSequence()
 	// Create shattered pieces instead of ragdoll
 	CreateShatteredPieces();
 
-	// Destroy actor after 3 seconds (extra time for dramatic effect)
+	// Park in the enemy pool after 3 seconds (extra time for dramatic effect),
+	// destroying only when the pool is full
 	GetWorldTimerManager().SetTimer(DeathTimerHandle, [this]()
 	{
-		Destroy();
+		UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this);
+		if (!EnemyPool || !EnemyPool->ReleaseEnemy(this))
+		{
+			Destroy();
+		}
 	}, 3.0f, false);
 }
 
+void ACybersoulsEnemyBase::DeactivateForPool()
+{
+	bInPool = true;
+	
+	// Stays dead while parked so damage, abilities and AI leave it alone
+	bIsDead = true;
+	
+	GetWorldTimerManager().ClearTimer(AttackTimerHandle);
+	GetWorldTimerManager().ClearTimer(HackTimerHandle);
+	GetWorldTimerManager().ClearTimer(DeathTimerHandle);
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterEnemy(this);
+	}
+	
+	if (StatusEffects)
+	{
+		StatusEffects->ClearAllEffects();
+	}
+	
+	// Unpossessing takes the controller off the think scheduler and resets its perception
+	if (AController* OwningController = GetController())
+	{
+		OwningController->StopMovement();
+		ParkedController = OwningController;
+		OwningController->UnPossess();
+	}
+	
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+	}
+	
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	
+	ParkedTickingComponents.Reset();
+	ForEachComponent<UActorComponent>(false, [this](UActorComponent* Component)
+	{
+		if (Component->IsComponentTickEnabled())
+		{
+			Component->SetComponentTickEnabled(false);
+			ParkedTickingComponents.Add(Component);
+		}
+	});
+}
+
+void ACybersoulsEnemyBase::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	if (!bInPool)
+	{
+		return;
+	}
+	
+	bInPool = false;
+	bIsDead = false;
+	
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	
+	for (UActorComponent* Component : ParkedTickingComponents)
+	{
+		if (IsValid(Component))
+		{
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+	ParkedTickingComponents.Reset();
+	
+	// Undo the death sequence using the class defaults
+	const ACybersoulsEnemyBase* Defaults = GetClass()->GetDefaultObject<ACybersoulsEnemyBase>();
+	GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Pawn, Defaults->GetCapsuleComponent()->GetCollisionResponseToChannel(ECC_Pawn));
+	if (GetMesh())
+	{
+		GetMesh()->SetVisibility(true);
+		GetMesh()->SetCollisionEnabled(Defaults->GetMesh()->GetCollisionEnabled());
+	}
+	
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetDefaultMovementMode();
+	}
+	
+	ResetForReuse();
+	StartBehaviorTimers();
+	
+	// Same registration a freshly spawned enemy does, through the game mode when there is one
+	AcybersoulsGameMode* CybersoulsGameMode = GetWorld()->GetAuthGameMode<AcybersoulsGameMode>();
+	if (CybersoulsGameMode)
+	{
+		CybersoulsGameMode->RegisterEnemy(this);
+	}
+	else if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEnemy(this);
+	}
+	
+	if (IsValid(ParkedController))
+	{
+		ParkedController->Possess(this);
+	}
+	else
+	{
+		SpawnDefaultController();
+	}
+	ParkedController = nullptr;
+}
+
+void ACybersoulsEnemyBase::ResetForReuse()
+{
+	CurrentTarget = nullptr;
+	
+	// Subclasses set their stats here, which also refills most of them
+	InitializeEnemy();
+	
+	if (CachedEnemyAttributes)
+	{
+		CachedEnemyAttributes->ResetAttributes();
+	}
+	
+	ForEachComponent<UBaseAbilityComponent>(false, [](UBaseAbilityComponent* Ability)
+	{
+		Ability->ResetAbility();
+	});
+	
+	if (StatusEffects)
+	{
+		StatusEffects->ClearAllEffects();
+	}
+}
+
 TSubclassOf<AController> ACybersoulsEnemyBase::GetDefaultControllerClass() const
 {
 	// Use different AI controllers based on enemy type
@@ -258,33 +470,24 @@ void ACybersoulsEnemyBase::CreateShatteredPieces()
 	GetMesh()->SetVisibility(false);
 	GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+	UDebrisPoolSubsystem* DebrisPool = UDebrisPoolSubsystem::Get(this);
+	if (!DebrisPool)
+	{
+		return;
+	}
+
 	// Get the bounds and location of the enemy
 	FVector MeshLocation = GetMesh()->GetComponentLocation();
 	FVector MeshBounds = GetMesh()->Bounds.BoxExtent;
+	UMaterialInterface* PieceMaterial = GetMesh()->GetMaterial(0);
 	
-	// For shatter effect, we'll create multiple skeletal mesh components
-	// Each will represent a piece of the shattered enemy
-	USkeletalMeshComponent* OriginalMesh = GetMesh();
-	
-	// Create shattered pieces as multiple skeletal mesh components
+	// Launch pooled pieces, nothing is created here once the pool is warm
 	for (int32 i = 0; i < ShatterPieceCount; i++)
 	{
-		// Create skeletal mesh component for each piece
-		USkeletalMeshComponent* Piece = NewObject<USkeletalMeshComponent>(this, *FString::Printf(TEXT("ShatterPiece_%d"), i));
-		Piece->SetSkeletalMesh(OriginalMesh->GetSkeletalMeshAsset());
-		Piece->SetAnimInstanceClass(nullptr); // No animation
-		Piece->RegisterComponent();
-		Piece->AttachToComponent(GetRootComponent(), FAttachmentTransformRules::KeepWorldTransform);
-		
-		// Copy materials
-		for (int32 MatIdx = 0; MatIdx < OriginalMesh->GetNumMaterials(); MatIdx++)
-		{
-			Piece->SetMaterial(MatIdx, OriginalMesh->GetMaterial(MatIdx));
-		}
-		
+		FDebrisPieceSpawn Spawn;
+
 		// Scale down each piece for shatter effect - smaller pieces for more pieces
-		float RandomScale = FMath::RandRange(0.15f, 0.35f);
-		Piece->SetWorldScale3D(FVector(RandomScale));
+		Spawn.Scale = FMath::RandRange(0.15f, 0.35f);
 		
 		// Position pieces randomly around the original location
 		FVector RandomOffset = FVector(
@@ -292,20 +495,14 @@ void ACybersoulsEnemyBase::CreateShatteredPieces()
 			FMath::RandRange(-MeshBounds.Y * 0.3f, MeshBounds.Y * 0.3f),
 			FMath::RandRange(-MeshBounds.Z * 0.2f, MeshBounds.Z * 0.5f)
 		);
-		Piece->SetWorldLocation(MeshLocation + RandomOffset);
+		Spawn.Location = MeshLocation + RandomOffset;
 		
 		// Random rotation for variety
-		Piece->SetWorldRotation(FRotator(
+		Spawn.Rotation = FRotator(
 			FMath::RandRange(0.0f, 360.0f),
 			FMath::RandRange(0.0f, 360.0f),
 			FMath::RandRange(0.0f, 360.0f)
-		));
-		
-		// Enable physics
-		Piece->SetSimulatePhysics(true);
-		Piece->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		Piece->SetCollisionResponseToAllChannels(ECR_Block);
-		Piece->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+		);
 		
 		// Calculate explosion direction from center
 		FVector ExplosionDirection = RandomOffset.GetSafeNormal();
@@ -323,8 +520,7 @@ void ACybersoulsEnemyBase::CreateShatteredPieces()
 		float ExplosionForce = FMath::RandRange(300.0f, 400.0f);
 		FVector Impulse = ExplosionDirection * ExplosionForce;
 		Impulse.Z += FMath::RandRange(200.0f, 300.0f); // Add upward force
-		
-		Piece->AddImpulse(Impulse * 10.0f, NAME_None, true); // Mass multiplier
+		Spawn.Impulse = Impulse * 10.0f; // Mass multiplier
 		
 		// Add random angular velocity for tumbling effect
 		FVector AngularImpulse = FVector(
@@ -332,13 +528,9 @@ void ACybersoulsEnemyBase::CreateShatteredPieces()
 			FMath::RandRange(-6.0f, 6.0f),
 			FMath::RandRange(-6.0f, 6.0f)
 		);
-		Piece->AddAngularImpulseInRadians(AngularImpulse * 200.0f, NAME_None, true);
-		
-		// Optionally hide some bones to create different piece shapes
-		// This would require bone hiding setup in the skeletal mesh
+		Spawn.AngularImpulse = AngularImpulse * 200.0f;
 		
-		// Store reference (but since we're using USkeletalMeshComponent, we can't store in TArray<UStaticMeshComponent*>
-		// So pieces will be cleaned up when actor is destroyed
+		DebrisPool->SpawnPiece(ShatterPieceMesh, PieceMaterial, Spawn);
 	}
 	
 	// Optional: Add particle effects at shatter point
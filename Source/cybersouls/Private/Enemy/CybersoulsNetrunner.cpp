@@ -30,6 +30,17 @@ void ACybersoulsNetrunner::BeginPlay()
 	}
 }
 
+void ACybersoulsNetrunner::ResetForReuse()
+{
+	Super::ResetForReuse();
+	
+	// Hacking resumes on reuse just like it starts in BeginPlay
+	if (HackAbility)
+	{
+		HackAbility->ActivateAbility();
+	}
+}
+
 void ACybersoulsNetrunner::InitializeEnemy()
 {
 	Super::InitializeEnemy();
@@ -0,0 +1,282 @@
+// DebrisPoolSubsystem.cpp
+#include "cybersouls/Public/Enemy/DebrisPoolSubsystem.h"
+#include "cybersouls/cybersouls.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+DECLARE_CYCLE_STAT(TEXT("Debris Pool"), STAT_DebrisPool, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Live Pieces"), STAT_DebrisLivePieces, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Pieces Created"), STAT_DebrisPiecesCreated, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Pieces Recycled"), STAT_DebrisPiecesRecycled, STATGROUP_Cybersouls);
+
+UDebrisPoolSubsystem* UDebrisPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UDebrisPoolSubsystem>() : nullptr;
+}
+
+void UDebrisPoolSubsystem::Deinitialize()
+{
+	LivePieces.Empty();
+	MeshPools.Empty();
+	PoolOwner = nullptr;
+	LoadedDefaultMesh = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UDebrisPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDebrisPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UDebrisPoolSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_DebrisPool);
+	SET_DWORD_STAT(STAT_DebrisLivePieces, LivePieces.Num());
+
+	if (LivePieces.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Pieces are kept in launch order, so expired ones are always at the front
+	int32 ExpiredCount = 0;
+	while (ExpiredCount < LivePieces.Num() && Now - LivePieces[ExpiredCount].SpawnTime >= PieceLifetime)
+	{
+		ReleasePiece(LivePieces[ExpiredCount]);
+		++ExpiredCount;
+	}
+	LivePieces.RemoveAt(0, ExpiredCount, EAllowShrinking::No);
+
+	// Settled pieces stop simulating but stay visible until they expire
+	for (FLivePiece& LivePiece : LivePieces)
+	{
+		if (Now - LivePiece.SpawnTime < PieceSleepTime)
+		{
+			break;
+		}
+
+		if (!LivePiece.bSleeping && IsValid(LivePiece.Piece))
+		{
+			LivePiece.Piece->SetSimulatePhysics(false);
+			LivePiece.Piece->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			LivePiece.bSleeping = true;
+		}
+	}
+}
+
+void UDebrisPoolSubsystem::PrewarmPieces(UStaticMesh* Mesh, int32 PieceCount)
+{
+	UStaticMesh* PieceMesh = ResolveMesh(Mesh);
+	if (!PieceMesh || PieceCount <= 0)
+	{
+		return;
+	}
+
+	FDebrisMeshPool& Pool = MeshPools.FindOrAdd(PieceMesh);
+	const int32 Wanted = PieceCount * PrewarmShattersPerArchetype;
+	const int32 Budget = MaxLivePieces - GetTotalPieceCount();
+	const int32 ToCreate = FMath::Min(Wanted - Pool.TotalPieces, Budget);
+
+	for (int32 Index = 0; Index < ToCreate; ++Index)
+	{
+		if (UStaticMeshComponent* Piece = CreatePiece(PieceMesh))
+		{
+			MeshPools.FindChecked(PieceMesh).FreePieces.Add(Piece);
+		}
+	}
+
+	if (ToCreate > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("DebrisPool: Pre-warmed %d pieces of %s (%d total)"), ToCreate, *PieceMesh->GetName(), GetTotalPieceCount());
+	}
+}
+
+void UDebrisPoolSubsystem::SpawnPiece(UStaticMesh* Mesh, UMaterialInterface* Material, const FDebrisPieceSpawn& Spawn)
+{
+	UStaticMesh* PieceMesh = ResolveMesh(Mesh);
+	UStaticMeshComponent* Piece = PieceMesh ? AcquirePiece(PieceMesh) : nullptr;
+	if (!Piece)
+	{
+		return;
+	}
+
+	if (Material)
+	{
+		Piece->SetMaterial(0, Material);
+	}
+
+	Piece->SetWorldLocationAndRotation(Spawn.Location, Spawn.Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	Piece->SetWorldScale3D(FVector(Spawn.Scale));
+	Piece->SetVisibility(true);
+	Piece->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	Piece->SetSimulatePhysics(true);
+	Piece->SetPhysicsLinearVelocity(FVector::ZeroVector);
+	Piece->SetPhysicsAngularVelocityInRadians(FVector::ZeroVector);
+	Piece->AddImpulse(Spawn.Impulse, NAME_None, true);
+	Piece->AddAngularImpulseInRadians(Spawn.AngularImpulse, NAME_None, true);
+
+	FLivePiece& LivePiece = LivePieces.AddDefaulted_GetRef();
+	LivePiece.Piece = Piece;
+	LivePiece.Mesh = PieceMesh;
+	LivePiece.SpawnTime = GetWorld()->GetTimeSeconds();
+}
+
+void UDebrisPoolSubsystem::ReleaseAllPieces()
+{
+	for (const FLivePiece& LivePiece : LivePieces)
+	{
+		ReleasePiece(LivePiece);
+	}
+	LivePieces.Reset();
+}
+
+UStaticMesh* UDebrisPoolSubsystem::ResolveMesh(UStaticMesh* Mesh)
+{
+	if (Mesh)
+	{
+		return Mesh;
+	}
+
+	// Loaded once, the first time an archetype relies on the default
+	if (!LoadedDefaultMesh)
+	{
+		LoadedDefaultMesh = Cast<UStaticMesh>(DefaultPieceMesh.TryLoad());
+	}
+	return LoadedDefaultMesh;
+}
+
+UStaticMeshComponent* UDebrisPoolSubsystem::CreatePiece(UStaticMesh* Mesh)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (!PoolOwner)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		PoolOwner = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!PoolOwner)
+		{
+			return nullptr;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(PoolOwner, TEXT("DebrisPoolRoot"));
+		PoolOwner->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UStaticMeshComponent* Piece = NewObject<UStaticMeshComponent>(PoolOwner);
+	Piece->SetMobility(EComponentMobility::Movable);
+	Piece->SetStaticMesh(Mesh);
+	Piece->SetGenerateOverlapEvents(false);
+	Piece->SetCanEverAffectNavigation(false);
+	Piece->SetCollisionResponseToAllChannels(ECR_Block);
+	Piece->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+	Piece->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+	Piece->SetCollisionResponseToChannel(ECC_Targeting, ECR_Ignore);
+	Piece->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Piece->SetVisibility(false);
+	Piece->RegisterComponent();
+
+	MeshPools.FindOrAdd(Mesh).TotalPieces++;
+	INC_DWORD_STAT(STAT_DebrisPiecesCreated);
+
+	return Piece;
+}
+
+UStaticMeshComponent* UDebrisPoolSubsystem::AcquirePiece(UStaticMesh* Mesh)
+{
+	FDebrisMeshPool& Pool = MeshPools.FindOrAdd(Mesh);
+	while (Pool.FreePieces.Num() > 0)
+	{
+		UStaticMeshComponent* Piece = Pool.FreePieces.Pop(EAllowShrinking::No);
+		if (IsValid(Piece))
+		{
+			return Piece;
+		}
+		Pool.TotalPieces--;
+	}
+
+	// Under budget the pool may still grow, a sign PrewarmShattersPerArchetype is too low
+	if (GetTotalPieceCount() < MaxLivePieces)
+	{
+		return CreatePiece(Mesh);
+	}
+
+	if (LivePieces.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// Over budget, recycle the oldest live piece, preferring one that already has this mesh
+	int32 RecycleIndex = LivePieces.IndexOfByPredicate([Mesh](const FLivePiece& LivePiece)
+	{
+		return LivePiece.Mesh == Mesh;
+	});
+	if (RecycleIndex == INDEX_NONE)
+	{
+		RecycleIndex = 0;
+	}
+
+	const FLivePiece Recycled = LivePieces[RecycleIndex];
+	LivePieces.RemoveAt(RecycleIndex, 1, EAllowShrinking::No);
+	INC_DWORD_STAT(STAT_DebrisPiecesRecycled);
+
+	if (!IsValid(Recycled.Piece))
+	{
+		MeshPools.FindOrAdd(Recycled.Mesh).TotalPieces--;
+		return CreatePiece(Mesh);
+	}
+
+	Recycled.Piece->SetSimulatePhysics(false);
+	if (Recycled.Mesh != Mesh)
+	{
+		// Move the piece over to this mesh's pool
+		MeshPools.FindOrAdd(Recycled.Mesh).TotalPieces--;
+		MeshPools.FindOrAdd(Mesh).TotalPieces++;
+		Recycled.Piece->SetStaticMesh(Mesh);
+	}
+
+	return Recycled.Piece;
+}
+
+void UDebrisPoolSubsystem::ReleasePiece(const FLivePiece& LivePiece)
+{
+	if (!IsValid(LivePiece.Piece))
+	{
+		MeshPools.FindOrAdd(LivePiece.Mesh).TotalPieces--;
+		return;
+	}
+
+	LivePiece.Piece->SetSimulatePhysics(false);
+	LivePiece.Piece->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	LivePiece.Piece->SetVisibility(false);
+	MeshPools.FindOrAdd(LivePiece.Mesh).FreePieces.Add(LivePiece.Piece);
+}
+
+int32 UDebrisPoolSubsystem::GetTotalPieceCount() const
+{
+	int32 Total = 0;
+	for (const TPair<UStaticMesh*, FDebrisMeshPool>& Pair : MeshPools)
+	{
+		Total += Pair.Value.TotalPieces;
+	}
+	return Total;
+}
@@ -0,0 +1,150 @@
+// EnemyPoolSubsystem.cpp
+#include "cybersouls/Public/Enemy/EnemyPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "EngineUtils.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Pool Spawn"), STAT_EnemyPoolSpawn, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Pool Reused"), STAT_EnemyPoolReused, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Pool Created"), STAT_EnemyPoolCreated, STATGROUP_Cybersouls);
+
+UEnemyPoolSubsystem* UEnemyPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UEnemyPoolSubsystem>() : nullptr;
+}
+
+void UEnemyPoolSubsystem::Deinitialize()
+{
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+ACybersoulsEnemyBase* UEnemyPoolSubsystem::SpawnEnemy(TSubclassOf<ACybersoulsEnemyBase> EnemyClass, const FTransform& Transform)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyPoolSpawn);
+
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	if (FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass))
+	{
+		while (Bucket->FreeEnemies.Num() > 0)
+		{
+			ACybersoulsEnemyBase* Enemy = Bucket->FreeEnemies.Pop(EAllowShrinking::No);
+			if (IsValid(Enemy))
+			{
+				Enemy->ActivateFromPool(Transform);
+				INC_DWORD_STAT(STAT_EnemyPoolReused);
+				return Enemy;
+			}
+		}
+	}
+
+	// Nothing parked, a sign the class should be pre-warmed
+	return CreateEnemy(EnemyClass, Transform);
+}
+
+bool UEnemyPoolSubsystem::ReleaseEnemy(ACybersoulsEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return false;
+	}
+
+	if (Enemy->IsInPool())
+	{
+		return true;
+	}
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(Enemy->GetClass());
+	if (Bucket.FreeEnemies.Num() >= MaxPooledPerClass)
+	{
+		return false;
+	}
+
+	Enemy->DeactivateForPool();
+	Bucket.FreeEnemies.Add(Enemy);
+	return true;
+}
+
+int32 UEnemyPoolSubsystem::ReleaseAllEnemies()
+{
+	TArray<ACybersoulsEnemyBase*> ActiveEnemies;
+	for (TActorIterator<ACybersoulsEnemyBase> ActorIterator(GetWorld()); ActorIterator; ++ActorIterator)
+	{
+		if (IsValid(*ActorIterator) && !ActorIterator->IsInPool())
+		{
+			ActiveEnemies.Add(*ActorIterator);
+		}
+	}
+
+	// Parking clears their timers, so nothing dying finishes mid-way
+	for (ACybersoulsEnemyBase* Enemy : ActiveEnemies)
+	{
+		Enemy->DeactivateForPool();
+		Buckets.FindOrAdd(Enemy->GetClass()).FreeEnemies.Add(Enemy);
+	}
+
+	return ActiveEnemies.Num();
+}
+
+void UEnemyPoolSubsystem::PrewarmEnemies(TSubclassOf<ACybersoulsEnemyBase> EnemyClass, int32 Count)
+{
+	if (!EnemyClass)
+	{
+		return;
+	}
+
+	const int32 Wanted = FMath::Min(Count, MaxPooledPerClass);
+	const int32 ToCreate = Wanted - GetFreeEnemyCount(EnemyClass);
+
+	for (int32 Index = 0; Index < ToCreate; ++Index)
+	{
+		ACybersoulsEnemyBase* Enemy = CreateEnemy(EnemyClass, FTransform(ParkingLocation));
+		if (!Enemy || !ReleaseEnemy(Enemy))
+		{
+			break;
+		}
+	}
+
+	if (ToCreate > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("EnemyPool: Pre-warmed %d %s (%d parked)"), ToCreate, *EnemyClass->GetName(), GetFreeEnemyCount(EnemyClass));
+	}
+}
+
+int32 UEnemyPoolSubsystem::GetFreeEnemyCount(TSubclassOf<ACybersoulsEnemyBase> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	return Bucket ? Bucket->FreeEnemies.Num() : 0;
+}
+
+ACybersoulsEnemyBase* UEnemyPoolSubsystem::CreateEnemy(UClass* EnemyClass, const FTransform& Transform)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// BeginPlay initializes the enemy, registers it and AutoPossessAI gives it a controller
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	ACybersoulsEnemyBase* Enemy = World->SpawnActor<ACybersoulsEnemyBase>(EnemyClass, Transform, SpawnParams);
+	if (Enemy)
+	{
+		INC_DWORD_STAT(STAT_EnemyPoolCreated);
+	}
+	return Enemy;
+}
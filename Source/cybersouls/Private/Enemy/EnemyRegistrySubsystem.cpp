@@ -0,0 +1,106 @@
+// EnemyRegistrySubsystem.cpp
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+UEnemyRegistrySubsystem* UEnemyRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UEnemyRegistrySubsystem>() : nullptr;
+}
+
+void UEnemyRegistrySubsystem::Deinitialize()
+{
+	LiveEnemies.Empty();
+	TypeBuckets.Empty();
+	DenseIndices.Empty();
+	RegisteredTypes.Empty();
+	SpatialGrid.Reset();
+	OnEnemyKilled.Clear();
+
+	Super::Deinitialize();
+}
+
+void UEnemyRegistrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Only enemies that crossed a cell boundary actually get re-hashed
+	for (ACybersoulsEnemyBase* Enemy : LiveEnemies)
+	{
+		SpatialGrid.Update(Enemy, Enemy->GetActorLocation());
+	}
+}
+
+TStatId UEnemyRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyRegistrySubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyRegistrySubsystem::RegisterEnemy(ACybersoulsEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->IsDead() || DenseIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	DenseIndices.Add(Enemy, LiveEnemies.Add(Enemy));
+	RegisteredTypes.Add(Enemy, Enemy->EnemyType);
+	GetBucket(Enemy->EnemyType).Enemies.Add(Enemy);
+	SpatialGrid.Insert(Enemy, Enemy->GetActorLocation());
+
+	UE_LOG(LogTemp, Log, TEXT("EnemyRegistry: Registered %s (%d live)"), *Enemy->GetName(), LiveEnemies.Num());
+}
+
+void UEnemyRegistrySubsystem::UnregisterEnemy(ACybersoulsEnemyBase* Enemy)
+{
+	int32 Index = INDEX_NONE;
+	if (!DenseIndices.RemoveAndCopyValue(Enemy, Index))
+	{
+		return;
+	}
+
+	// Swap-remove and patch the index of whichever enemy moved into the hole
+	LiveEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (LiveEnemies.IsValidIndex(Index))
+	{
+		DenseIndices.FindChecked(LiveEnemies[Index]) = Index;
+	}
+
+	EEnemyType BucketType = EEnemyType::Basic;
+	if (RegisteredTypes.RemoveAndCopyValue(Enemy, BucketType))
+	{
+		GetBucket(BucketType).Enemies.RemoveSingleSwap(Enemy, EAllowShrinking::No);
+	}
+
+	SpatialGrid.Remove(Enemy);
+}
+
+void UEnemyRegistrySubsystem::NotifyEnemyKilled(ACybersoulsEnemyBase* Enemy)
+{
+	UnregisterEnemy(Enemy);
+	OnEnemyKilled.Broadcast(Enemy);
+}
+
+const TArray<ACybersoulsEnemyBase*>& UEnemyRegistrySubsystem::GetEnemiesOfType(EEnemyType Type) const
+{
+	static const TArray<ACybersoulsEnemyBase*> EmptyBucket;
+
+	const int32 BucketIndex = static_cast<int32>(Type);
+	return TypeBuckets.IsValidIndex(BucketIndex) ? TypeBuckets[BucketIndex].Enemies : EmptyBucket;
+}
+
+FEnemyTypeBucket& UEnemyRegistrySubsystem::GetBucket(EEnemyType Type)
+{
+	const int32 BucketIndex = static_cast<int32>(Type);
+	if (!TypeBuckets.IsValidIndex(BucketIndex))
+	{
+		TypeBuckets.SetNum(BucketIndex + 1);
+	}
+	return TypeBuckets[BucketIndex];
+}
@@ -0,0 +1,171 @@
+// EnemySpatialGrid.cpp
+#include "cybersouls/Public/Enemy/EnemySpatialGrid.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+
+FEnemySpatialGrid::FEnemySpatialGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+	, InvCellSize(1.0f / CellSize)
+{
+}
+
+FIntPoint FEnemySpatialGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvCellSize),
+		FMath::FloorToInt32(Location.Y * InvCellSize));
+}
+
+void FEnemySpatialGrid::Insert(ACybersoulsEnemyBase* Enemy, const FVector& Location)
+{
+	if (!Enemy || EnemyCells.Contains(Enemy))
+	{
+		return;
+	}
+
+	const FIntPoint Cell = GetCell(Location);
+	EnemyCells.Add(Enemy, Cell);
+	Cells.FindOrAdd(Cell).Add(Enemy);
+}
+
+void FEnemySpatialGrid::Remove(const ACybersoulsEnemyBase* Enemy)
+{
+	FIntPoint Cell;
+	if (EnemyCells.RemoveAndCopyValue(Enemy, Cell))
+	{
+		RemoveFromCell(Enemy, Cell);
+	}
+}
+
+void FEnemySpatialGrid::Update(ACybersoulsEnemyBase* Enemy, const FVector& Location)
+{
+	FIntPoint* CurrentCell = EnemyCells.Find(Enemy);
+	if (!CurrentCell)
+	{
+		Insert(Enemy, Location);
+		return;
+	}
+
+	const FIntPoint NewCell = GetCell(Location);
+	if (NewCell == *CurrentCell)
+	{
+		return;
+	}
+
+	RemoveFromCell(Enemy, *CurrentCell);
+	*CurrentCell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Enemy);
+}
+
+void FEnemySpatialGrid::Reset()
+{
+	Cells.Empty();
+	EnemyCells.Empty();
+}
+
+void FEnemySpatialGrid::RemoveFromCell(const ACybersoulsEnemyBase* Enemy, const FIntPoint& Cell)
+{
+	if (TArray<ACybersoulsEnemyBase*>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(const_cast<ACybersoulsEnemyBase*>(Enemy), EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+template <typename PredicateType>
+void FEnemySpatialGrid::ForEachInCells(const FVector& Min, const FVector& Max, PredicateType&& Predicate, TArray<ACybersoulsEnemyBase*>& OutEnemies) const
+{
+	const FIntPoint MinCell = GetCell(Min);
+	const FIntPoint MaxCell = GetCell(Max);
+
+	// A query covering more cells than are occupied is cheaper to answer by
+	// walking the occupied cells directly
+	const int64 CoveredCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+	if (CoveredCells > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<ACybersoulsEnemyBase*>>& Pair : Cells)
+		{
+			if (Pair.Key.X < MinCell.X || Pair.Key.X > MaxCell.X || Pair.Key.Y < MinCell.Y || Pair.Key.Y > MaxCell.Y)
+			{
+				continue;
+			}
+
+			for (ACybersoulsEnemyBase* Enemy : Pair.Value)
+			{
+				if (Predicate(Enemy->GetActorLocation()))
+				{
+					OutEnemies.Add(Enemy);
+				}
+			}
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<ACybersoulsEnemyBase*>* Bucket = Cells.Find(FIntPoint(X, Y));
+			if (!Bucket)
+			{
+				continue;
+			}
+
+			for (ACybersoulsEnemyBase* Enemy : *Bucket)
+			{
+				if (Predicate(Enemy->GetActorLocation()))
+				{
+					OutEnemies.Add(Enemy);
+				}
+			}
+		}
+	}
+}
+
+void FEnemySpatialGrid::QueryRadius(const FVector& Origin, float Radius, TArray<ACybersoulsEnemyBase*>& OutEnemies) const
+{
+	const float RadiusSquared = FMath::Square(Radius);
+	const FVector Extent(Radius, Radius, 0.0f);
+
+	ForEachInCells(Origin - Extent, Origin + Extent, [&](const FVector& Location)
+	{
+		return FVector::DistSquared(Origin, Location) <= RadiusSquared;
+	}, OutEnemies);
+}
+
+void FEnemySpatialGrid::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<ACybersoulsEnemyBase*>& OutEnemies) const
+{
+	const FVector Axis = Direction.GetSafeNormal();
+	const float RadiusSquared = FMath::Square(Radius);
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+	const float CosSquared = FMath::Square(CosHalfAngle);
+	const FVector Extent(Radius, Radius, 0.0f);
+
+	ForEachInCells(Origin - Extent, Origin + Extent, [&](const FVector& Location)
+	{
+		const FVector ToTarget = Location - Origin;
+		const float DistSquared = ToTarget.SizeSquared();
+		if (DistSquared > RadiusSquared)
+		{
+			return false;
+		}
+
+		// Compare Dot / |ToTarget| against the cone cosine without a square root
+		const float Dot = FVector::DotProduct(Axis, ToTarget);
+		if (CosHalfAngle >= 0.0f)
+		{
+			return Dot >= 0.0f && FMath::Square(Dot) >= CosSquared * DistSquared;
+		}
+		return Dot >= 0.0f || FMath::Square(Dot) <= CosSquared * DistSquared;
+	}, OutEnemies);
+}
+
+void FEnemySpatialGrid::QueryBox(const FBox& Box, TArray<ACybersoulsEnemyBase*>& OutEnemies) const
+{
+	ForEachInCells(Box.Min, Box.Max, [&](const FVector& Location)
+	{
+		return Box.IsInsideOrOn(Location);
+	}, OutEnemies);
+}
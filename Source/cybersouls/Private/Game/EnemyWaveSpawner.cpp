@@ -0,0 +1,427 @@
+// EnemyWaveSpawner.cpp
+#include "cybersouls/Public/Game/EnemyWaveSpawner.h"
+#include "cybersouls/Public/Game/cybersoulsGameMode.h"
+#include "cybersouls/Public/Enemy/EnemyPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "cybersouls/Public/Enemy/CybersoulsBasicEnemy.h"
+#include "cybersouls/Public/Enemy/CybersoulsBlockEnemy.h"
+#include "cybersouls/Public/Enemy/CybersoulsDodgeEnemy.h"
+#include "cybersouls/Public/Enemy/CybersoulsNetrunner.h"
+#include "cybersouls/Public/Enemy/CybersoulsBuffNetrunner.h"
+#include "cybersouls/Public/Enemy/CybersoulsDebuffNetrunner.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("Wave Spawner"), STAT_WaveSpawner, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Wave Spawn Hitches"), STAT_WaveSpawnHitches, STATGROUP_Cybersouls);
+
+AEnemyWaveSpawner::AEnemyWaveSpawner()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	// Native classes by default, designers point these at their Blueprints
+	EnemyClasses.Add(EEnemyType::Basic, ACybersoulsBasicEnemy::StaticClass());
+	EnemyClasses.Add(EEnemyType::Block, ACybersoulsBlockEnemy::StaticClass());
+	EnemyClasses.Add(EEnemyType::Dodge, ACybersoulsDodgeEnemy::StaticClass());
+	EnemyClasses.Add(EEnemyType::Netrunner, ACybersoulsNetrunner::StaticClass());
+	EnemyClasses.Add(EEnemyType::BuffNetrunner, ACybersoulsBuffNetrunner::StaticClass());
+	EnemyClasses.Add(EEnemyType::DebuffNetrunner, ACybersoulsDebuffNetrunner::StaticClass());
+}
+
+void AEnemyWaveSpawner::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (AcybersoulsGameMode* GameMode = GetWorld()->GetAuthGameMode<AcybersoulsGameMode>())
+	{
+		GameMode->RegisterWaveSpawner(this);
+	}
+
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		EnemyKilledHandle = Registry->OnEnemyKilled.AddUObject(this, &AEnemyWaveSpawner::HandleRegisteredEnemyKilled);
+	}
+
+	if (bStartOnBeginPlay)
+	{
+		StartWaves();
+	}
+}
+
+void AEnemyWaveSpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->OnEnemyKilled.Remove(EnemyKilledHandle);
+	}
+	EnemyKilledHandle.Reset();
+
+	if (AcybersoulsGameMode* GameMode = GetWorld()->GetAuthGameMode<AcybersoulsGameMode>())
+	{
+		GameMode->UnregisterWaveSpawner(this);
+	}
+
+	for (TSharedPtr<FStreamableHandle>& Handle : WaveLoadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	WaveLoadHandles.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AEnemyWaveSpawner::StartWaves()
+{
+	if (Phase != EWavePhase::Idle || Waves.Num() == 0)
+	{
+		return;
+	}
+
+	// Kept across ResetWaves, so waves whose handles EndWave has not released yet stay loaded
+	if (WaveLoadHandles.Num() != Waves.Num())
+	{
+		WaveLoadHandles.SetNum(Waves.Num());
+		WaveLoaded.Init(false, Waves.Num());
+	}
+
+	SetActorTickEnabled(true);
+	BeginWave(0);
+}
+
+void AEnemyWaveSpawner::ResetWaves()
+{
+	Phase = EWavePhase::Idle;
+	CurrentWave = INDEX_NONE;
+	PendingSpawns.Reset();
+	NextPendingSpawn = 0;
+	PendingPrewarms.Reset();
+	AliveWaveEnemies.Reset();
+	SetActorTickEnabled(false);
+
+	if (bStartOnBeginPlay)
+	{
+		StartWaves();
+	}
+}
+
+bool AEnemyWaveSpawner::HasPendingWaves() const
+{
+	return Phase != EWavePhase::Idle && Phase != EWavePhase::Finished;
+}
+
+void AEnemyWaveSpawner::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_WaveSpawner);
+
+	switch (Phase)
+	{
+		case EWavePhase::Waiting:
+			if (GetWorld()->GetTimeSeconds() >= WaveReadyTime && WaveLoaded[CurrentWave])
+			{
+				QueueWaveSpawns(CurrentWave);
+				Phase = EWavePhase::Spawning;
+				OnWaveStarted.Broadcast(CurrentWave);
+			}
+			else
+			{
+				ProcessPrewarms();
+			}
+			break;
+
+		case EWavePhase::Spawning:
+			ProcessSpawns();
+			if (NextPendingSpawn >= PendingSpawns.Num())
+			{
+				PendingSpawns.Reset();
+				NextPendingSpawn = 0;
+				Phase = EWavePhase::Fighting;
+			}
+			break;
+
+		case EWavePhase::Fighting:
+			// Enemies removed without dying (destroyed by a level reset, say) never report a kill
+			for (auto It = AliveWaveEnemies.CreateIterator(); It; ++It)
+			{
+				if (!It->IsValid() || (*It)->IsInPool())
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			if (AliveWaveEnemies.Num() == 0)
+			{
+				EndWave(false);
+			}
+			else
+			{
+				ProcessPrewarms();
+			}
+			break;
+
+		default:
+			SetActorTickEnabled(false);
+			break;
+	}
+}
+
+void AEnemyWaveSpawner::BeginWave(int32 WaveIndex)
+{
+	CurrentWave = WaveIndex;
+	WaveReadyTime = GetWorld()->GetTimeSeconds() + Waves[WaveIndex].StartDelay;
+	Phase = EWavePhase::Waiting;
+
+	// Load this wave and the next one, so the next is ready before it is needed
+	RequestWaveLoad(WaveIndex);
+	if (Waves.IsValidIndex(WaveIndex + 1))
+	{
+		RequestWaveLoad(WaveIndex + 1);
+	}
+}
+
+void AEnemyWaveSpawner::RequestWaveLoad(int32 WaveIndex)
+{
+	if (WaveLoaded[WaveIndex] || WaveLoadHandles[WaveIndex].IsValid())
+	{
+		return;
+	}
+
+	// Loading a class brings in the meshes and materials it references
+	TArray<FSoftObjectPath> ClassPaths;
+	for (const FEnemyWaveEntry& Entry : Waves[WaveIndex].Entries)
+	{
+		const TSoftClassPtr<ACybersoulsEnemyBase>* SoftClass = EnemyClasses.Find(Entry.EnemyType);
+		if (SoftClass && !SoftClass->IsNull())
+		{
+			ClassPaths.AddUnique(SoftClass->ToSoftObjectPath());
+		}
+	}
+
+	if (ClassPaths.Num() == 0)
+	{
+		HandleWaveLoaded(WaveIndex);
+		return;
+	}
+
+	WaveLoadHandles[WaveIndex] = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ClassPaths,
+		FStreamableDelegate::CreateUObject(this, &AEnemyWaveSpawner::HandleWaveLoaded, WaveIndex),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (!WaveLoadHandles[WaveIndex].IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("EnemyWaveSpawner: Could not request loading wave %d"), WaveIndex);
+		HandleWaveLoaded(WaveIndex);
+	}
+}
+
+void AEnemyWaveSpawner::HandleWaveLoaded(int32 WaveIndex)
+{
+	if (!WaveLoaded.IsValidIndex(WaveIndex) || WaveLoaded[WaveIndex])
+	{
+		return;
+	}
+
+	WaveLoaded[WaveIndex] = true;
+
+	// Pre-warm enough parked enemies for the whole wave, a few per frame
+	TMap<UClass*, int32> NeededPerClass;
+	for (const FEnemyWaveEntry& Entry : Waves[WaveIndex].Entries)
+	{
+		if (UClass* EnemyClass = ResolveEnemyClass(Entry.EnemyType))
+		{
+			NeededPerClass.FindOrAdd(EnemyClass) += Entry.Count;
+		}
+	}
+
+	for (const TPair<UClass*, int32>& Needed : NeededPerClass)
+	{
+		FPendingPrewarm& Prewarm = PendingPrewarms.AddDefaulted_GetRef();
+		Prewarm.EnemyClass = Needed.Key;
+		Prewarm.WantedFree = Needed.Value;
+		Prewarm.WaveIndex = WaveIndex;
+	}
+}
+
+void AEnemyWaveSpawner::QueueWaveSpawns(int32 WaveIndex)
+{
+	PendingSpawns.Reset();
+	NextPendingSpawn = 0;
+
+	for (const FEnemyWaveEntry& Entry : Waves[WaveIndex].Entries)
+	{
+		TSubclassOf<ACybersoulsEnemyBase> EnemyClass = ResolveEnemyClass(Entry.EnemyType);
+		if (!EnemyClass)
+		{
+			UE_LOG(LogTemp, Error, TEXT("EnemyWaveSpawner: No class for enemy type %d in wave %d"), static_cast<int32>(Entry.EnemyType), WaveIndex);
+			continue;
+		}
+
+		for (int32 Ordinal = 0; Ordinal < Entry.Count; ++Ordinal)
+		{
+			FPendingSpawn& Spawn = PendingSpawns.AddDefaulted_GetRef();
+			Spawn.EnemyClass = EnemyClass;
+			Spawn.Transform = PickSpawnTransform(Entry, Ordinal);
+		}
+	}
+
+	// Whatever was not pre-warmed in time for this wave is spawned directly from the queue
+	PendingPrewarms.RemoveAll([WaveIndex](const FPendingPrewarm& Prewarm)
+	{
+		return Prewarm.WaveIndex <= WaveIndex;
+	});
+}
+
+void AEnemyWaveSpawner::ProcessSpawns()
+{
+	UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this);
+	if (!EnemyPool)
+	{
+		NextPendingSpawn = PendingSpawns.Num();
+		return;
+	}
+
+	int32 Spawned = 0;
+	while (NextPendingSpawn < PendingSpawns.Num() && Spawned < MaxSpawnsPerFrame)
+	{
+		const FPendingSpawn& Pending = PendingSpawns[NextPendingSpawn++];
+
+		const double StartTime = FPlatformTime::Seconds();
+		ACybersoulsEnemyBase* Enemy = EnemyPool->SpawnEnemy(Pending.EnemyClass, Pending.Transform);
+		ReportHitch(TEXT("Spawning"), Pending.EnemyClass, StartTime);
+
+		if (Enemy)
+		{
+			AliveWaveEnemies.Add(Enemy);
+		}
+		++Spawned;
+	}
+}
+
+void AEnemyWaveSpawner::ProcessPrewarms()
+{
+	UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this);
+	if (!EnemyPool)
+	{
+		PendingPrewarms.Reset();
+		return;
+	}
+
+	int32 Prewarmed = 0;
+	while (PendingPrewarms.Num() > 0 && Prewarmed < MaxPrewarmsPerFrame)
+	{
+		const FPendingPrewarm& Prewarm = PendingPrewarms[0];
+		const int32 FreeBefore = EnemyPool->GetFreeEnemyCount(Prewarm.EnemyClass);
+		if (FreeBefore >= FMath::Min(Prewarm.WantedFree, EnemyPool->MaxPooledPerClass))
+		{
+			PendingPrewarms.RemoveAt(0, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		EnemyPool->PrewarmEnemies(Prewarm.EnemyClass, FreeBefore + 1);
+		ReportHitch(TEXT("Pre-warming"), Prewarm.EnemyClass, StartTime);
+		++Prewarmed;
+
+		// Spawning failed, do not retry every frame
+		if (EnemyPool->GetFreeEnemyCount(Prewarm.EnemyClass) <= FreeBefore)
+		{
+			PendingPrewarms.RemoveAt(0, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+void AEnemyWaveSpawner::EndWave(bool bFromDeath)
+{
+	AliveWaveEnemies.Reset();
+	OnWaveCleared.Broadcast(CurrentWave);
+
+	// The previous wave's classes are no longer needed once this one is done
+	if (WaveLoadHandles.IsValidIndex(CurrentWave - 1) && WaveLoadHandles[CurrentWave - 1].IsValid())
+	{
+		WaveLoadHandles[CurrentWave - 1]->ReleaseHandle();
+		WaveLoadHandles[CurrentWave - 1].Reset();
+		WaveLoaded[CurrentWave - 1] = false;
+	}
+
+	if (Waves.IsValidIndex(CurrentWave + 1))
+	{
+		BeginWave(CurrentWave + 1);
+		return;
+	}
+
+	Phase = EWavePhase::Finished;
+	UE_LOG(LogTemp, Log, TEXT("EnemyWaveSpawner: %s finished all %d waves"), *GetName(), Waves.Num());
+
+	// A death reaches the game mode's OnEnemyDeath right after this, which completes
+	// the quest; otherwise nobody else will notice the last wave ended
+	if (!bFromDeath)
+	{
+		AcybersoulsGameMode* GameMode = GetWorld()->GetAuthGameMode<AcybersoulsGameMode>();
+		if (GameMode && GameMode->AreAllEnemiesDead() && !GameMode->HasPendingWaves())
+		{
+			GameMode->CompleteQuest();
+		}
+	}
+}
+
+void AEnemyWaveSpawner::HandleRegisteredEnemyKilled(ACybersoulsEnemyBase* KilledEnemy)
+{
+	if (AliveWaveEnemies.Remove(TWeakObjectPtr<ACybersoulsEnemyBase>(KilledEnemy)) == 0)
+	{
+		return;
+	}
+
+	// Still spawning, the wave is not over even if everything so far has died
+	if (Phase == EWavePhase::Fighting && AliveWaveEnemies.Num() == 0)
+	{
+		EndWave(true);
+	}
+}
+
+TSubclassOf<ACybersoulsEnemyBase> AEnemyWaveSpawner::ResolveEnemyClass(EEnemyType EnemyType) const
+{
+	const TSoftClassPtr<ACybersoulsEnemyBase>* SoftClass = EnemyClasses.Find(EnemyType);
+	return SoftClass ? SoftClass->Get() : nullptr;
+}
+
+FTransform AEnemyWaveSpawner::PickSpawnTransform(const FEnemyWaveEntry& Entry, int32 Ordinal) const
+{
+	const AActor* SpawnPoint = nullptr;
+	if (Entry.SpawnPointIndices.Num() > 0)
+	{
+		const int32 PointIndex = Entry.SpawnPointIndices[Ordinal % Entry.SpawnPointIndices.Num()];
+		SpawnPoint = SpawnPoints.IsValidIndex(PointIndex) ? SpawnPoints[PointIndex] : nullptr;
+	}
+	else if (SpawnPoints.Num() > 0)
+	{
+		SpawnPoint = SpawnPoints[Ordinal % SpawnPoints.Num()];
+	}
+
+	FTransform Transform = IsValid(SpawnPoint) ? SpawnPoint->GetActorTransform() : GetActorTransform();
+	Transform.SetScale3D(FVector::OneVector);
+
+	// Pooled enemies are teleported without collision handling, so keep them apart
+	const FVector2D Scatter = FMath::RandPointInCircle(SpawnScatterRadius);
+	Transform.AddToTranslation(FVector(Scatter.X, Scatter.Y, 0.0f));
+	return Transform;
+}
+
+void AEnemyWaveSpawner::ReportHitch(const TCHAR* Operation, const UClass* EnemyClass, double StartTime) const
+{
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	if (ElapsedMs > SpawnHitchThresholdMs)
+	{
+		INC_DWORD_STAT(STAT_WaveSpawnHitches);
+		UE_LOG(LogTemp, Warning, TEXT("EnemyWaveSpawner: %s %s took %.2f ms (wave %d, threshold %.2f ms)"),
+			Operation, EnemyClass ? *EnemyClass->GetName() : TEXT("None"), ElapsedMs, CurrentWave, SpawnHitchThresholdMs);
+	}
+}
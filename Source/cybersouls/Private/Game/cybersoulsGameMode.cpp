@@ -4,9 +4,15 @@
 #include "cybersouls/Public/Character/cybersoulsCharacter.h"
 #include "cybersouls/Public/UI/CybersoulsHUD.h"
 #include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "cybersouls/Public/Enemy/EnemyPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/DebrisPoolSubsystem.h"
+#include "cybersouls/Public/Game/EnemyWaveSpawner.h"
 #include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
 #include "cybersouls/Public/Attributes/PlayerProgressionComponent.h"
 #include "cybersouls/Public/Player/CyberSoulsPlayerController.h"
+#include "cybersouls/Public/Abilities/QuickHackComponent.h"
+#include "cybersouls/Public/Combat/DamageQueueSubsystem.h"
 #include "UObject/ConstructorHelpers.h"
 #include "EngineUtils.h"
 #include "Engine/Engine.h"
@@ -35,29 +41,39 @@ void AcybersoulsGameMode::BeginPlay()
 	// Find and register all enemies in the level
 	FindAndRegisterAllEnemies();
 	
-	UE_LOG(LogTemp, Warning, TEXT("GameMode initialized with %d enemies"), AliveEnemies.Num());
+	UE_LOG(LogTemp, Warning, TEXT("GameMode initialized with %d enemies"), GetAliveEnemyCount());
+}
+
+UEnemyRegistrySubsystem* AcybersoulsGameMode::GetEnemyRegistry() const
+{
+	return GetWorld() ? GetWorld()->GetSubsystem<UEnemyRegistrySubsystem>() : nullptr;
 }
 
 void AcybersoulsGameMode::FindAndRegisterAllEnemies()
 {
-	AliveEnemies.Empty();
-	
+	// Enemies register themselves in BeginPlay; this only catches any whose
+	// BeginPlay has not run yet when the game mode starts. It also snapshots
+	// the level's enemies for SoftResetLevel.
+	InitialEnemies.Reset();
 	for (TActorIterator<ACybersoulsEnemyBase> ActorIterator(GetWorld()); ActorIterator; ++ActorIterator)
 	{
 		ACybersoulsEnemyBase* Enemy = *ActorIterator;
-		if (IsValid(Enemy))
+		if (IsValid(Enemy) && !Enemy->IsInPool())
 		{
 			RegisterEnemy(Enemy);
+			
+			FEnemySnapshot& Snapshot = InitialEnemies.AddDefaulted_GetRef();
+			Snapshot.EnemyClass = Enemy->GetClass();
+			Snapshot.Transform = Enemy->GetActorTransform();
 		}
 	}
 }
 
 void AcybersoulsGameMode::RegisterEnemy(ACybersoulsEnemyBase* Enemy)
 {
-	if (IsValid(Enemy) && !AliveEnemies.Contains(Enemy))
+	if (UEnemyRegistrySubsystem* Registry = GetEnemyRegistry())
 	{
-		AliveEnemies.Add(Enemy);
-		UE_LOG(LogTemp, Log, TEXT("Registered enemy: %s"), *Enemy->GetName());
+		Registry->RegisterEnemy(Enemy);
 	}
 }
 
@@ -65,10 +81,15 @@ void AcybersoulsGameMode::OnEnemyDeath(ACybersoulsEnemyBase* Enemy)
 {
 	if (IsValid(Enemy))
 	{
-		AliveEnemies.Remove(Enemy);
-		UE_LOG(LogTemp, Warning, TEXT("Enemy died: %s. Remaining: %d"), *Enemy->GetName(), AliveEnemies.Num());
+		// Normally already removed by the enemy itself; harmless if so
+		if (UEnemyRegistrySubsystem* Registry = GetEnemyRegistry())
+		{
+			Registry->UnregisterEnemy(Enemy);
+		}
+		
+		UE_LOG(LogTemp, Warning, TEXT("Enemy died: %s. Remaining: %d"), *Enemy->GetName(), GetAliveEnemyCount());
 		
-		if (AreAllEnemiesDead())
+		if (AreAllEnemiesDead() && !HasPendingWaves())
 		{
 			CompleteQuest();
 		}
@@ -77,7 +98,46 @@ void AcybersoulsGameMode::OnEnemyDeath(ACybersoulsEnemyBase* Enemy)
 
 bool AcybersoulsGameMode::AreAllEnemiesDead() const
 {
-	return AliveEnemies.Num() == 0;
+	return GetAliveEnemyCount() == 0;
+}
+
+void AcybersoulsGameMode::RegisterWaveSpawner(AEnemyWaveSpawner* Spawner)
+{
+	if (IsValid(Spawner))
+	{
+		WaveSpawners.AddUnique(Spawner);
+	}
+}
+
+void AcybersoulsGameMode::UnregisterWaveSpawner(AEnemyWaveSpawner* Spawner)
+{
+	WaveSpawners.Remove(Spawner);
+}
+
+bool AcybersoulsGameMode::HasPendingWaves() const
+{
+	for (const TWeakObjectPtr<AEnemyWaveSpawner>& Spawner : WaveSpawners)
+	{
+		if (Spawner.IsValid() && Spawner->HasPendingWaves())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 AcybersoulsGameMode::GetAliveEnemyCount() const
+{
+	UEnemyRegistrySubsystem* Registry = GetEnemyRegistry();
+	return Registry ? Registry->GetLiveEnemyCount() : 0;
+}
+
+const TArray<ACybersoulsEnemyBase*>& AcybersoulsGameMode::GetAliveEnemies() const
+{
+	static const TArray<ACybersoulsEnemyBase*> NoEnemies;
+
+	UEnemyRegistrySubsystem* Registry = GetEnemyRegistry();
+	return Registry ? Registry->GetLiveEnemies() : NoEnemies;
 }
 
 void AcybersoulsGameMode::CompleteQuest()
@@ -172,11 +232,9 @@ void AcybersoulsGameMode::RestartLevel(bool bResetXP)
 					PlayerProgression->ResetProgression();
 				}
 				
-				// Always save progression (either current values or reset values)
+				// Always save progression (either current values or reset values);
+				// the file is written in the background, even across a reload
 				PlayerProgression->SaveProgression();
-				
-				// Force a small delay to ensure save completes
-				FPlatformProcess::Sleep(0.1f);
 			}
 		}
 		
@@ -186,12 +244,96 @@ void AcybersoulsGameMode::RestartLevel(bool bResetXP)
 		PC->bShowMouseCursor = false;
 	}
 	
+	if (bUseSoftReset && SoftResetLevel())
+	{
+		return;
+	}
+	
 	// Use UGameplayStatics for level restart
 	FString MapName = GetWorld()->GetMapName();
 	UE_LOG(LogTemp, Warning, TEXT("Restarting level: %s"), *MapName);
 	UGameplayStatics::OpenLevel(GetWorld(), FName(*MapName), false);
 }
 
+bool AcybersoulsGameMode::SoftResetLevel()
+{
+	UWorld* World = GetWorld();
+	UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this);
+	ACyberSoulsPlayerController* CyberPC = World ? Cast<ACyberSoulsPlayerController>(World->GetFirstPlayerController()) : nullptr;
+	if (!EnemyPool || !CyberPC)
+	{
+		return false;
+	}
+	
+	const double StartTime = FPlatformTime::Seconds();
+	
+	if (!CyberPC->ResetForLevelRestart())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SoftResetLevel: Player could not be reset, reloading instead"));
+		return false;
+	}
+	
+	// Spawners first, so parking their enemies below does not end a wave
+	for (const TWeakObjectPtr<AEnemyWaveSpawner>& Spawner : WaveSpawners)
+	{
+		if (Spawner.IsValid())
+		{
+			Spawner->ResetWaves();
+		}
+	}
+	
+	// Park every enemy still in the world, alive, dying or dead; this clears their timers
+	DiscardPendingCombat();
+	EnemyPool->ReleaseAllEnemies();
+	
+	if (UDebrisPoolSubsystem* DebrisPool = UDebrisPoolSubsystem::Get(this))
+	{
+		DebrisPool->ReleaseAllPieces();
+	}
+	
+	// Bring the level's own enemies back where they started
+	for (const FEnemySnapshot& Snapshot : InitialEnemies)
+	{
+		EnemyPool->SpawnEnemy(Snapshot.EnemyClass, Snapshot.Transform);
+	}
+	
+	if (ACybersoulsHUD* CybersoulsHUD = Cast<ACybersoulsHUD>(CyberPC->GetHUD()))
+	{
+		CybersoulsHUD->ResetForLevelRestart();
+	}
+	
+	UE_LOG(LogTemp, Warning, TEXT("SoftResetLevel: Restored %d enemies in %.2f ms"),
+		InitialEnemies.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return true;
+}
+
+void AcybersoulsGameMode::DiscardPendingCombat()
+{
+	if (UDamageQueueSubsystem* DamageQueue = UDamageQueueSubsystem::Get(this))
+	{
+		DamageQueue->DiscardPendingDamage();
+	}
+	
+	// Cascade timers belong to the player's QuickHacks, so parking the enemies does not clear them
+	ACyberSoulsPlayerController* CyberPC = Cast<ACyberSoulsPlayerController>(GetWorld()->GetFirstPlayerController());
+	if (!CyberPC)
+	{
+		return;
+	}
+	
+	const bool bCharacterKinds[] = { false, true };
+	for (bool bCyberState : bCharacterKinds)
+	{
+		if (ACharacter* Character = CyberPC->GetPooledCharacter(bCyberState))
+		{
+			Character->ForEachComponent<UQuickHackComponent>(false, [](UQuickHackComponent* QuickHack)
+			{
+				QuickHack->ResetAbility();
+			});
+		}
+	}
+}
+
 void AcybersoulsGameMode::OnPlayerDeath()
 {
 	UE_LOG(LogTemp, Warning, TEXT("Player has died!"));
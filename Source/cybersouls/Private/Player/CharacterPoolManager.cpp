@@ -93,6 +93,13 @@ void ACharacterPoolManager::SwapActiveCharacter()
     }
 }
 
+void ACharacterPoolManager::ResetPool()
+{
+    if (CyberStateCharacter) HideCharacter(CyberStateCharacter);
+    if (DefaultCharacter) ShowCharacter(DefaultCharacter);
+    bDefaultCharacterActive = true;
+}
+
 void ACharacterPoolManager::CleanupPool()
 {
     if (DefaultCharacter)
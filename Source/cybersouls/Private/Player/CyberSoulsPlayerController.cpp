@@ -5,7 +5,12 @@
 #include "cybersouls/Public/Input/CyberSoulsInputConfig.h"
 #include "cybersouls/Public/UI/CybersoulsHUD.h"
 #include "cybersouls/Public/Game/cybersoulsGameMode.h"
-#include "cybersouls/Public/AI/BaseEnemyAIController.h"
+#include "cybersouls/Public/Abilities/BaseAbilityComponent.h"
+#include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
+#include "cybersouls/Public/Player/PlayerCyberStateAttributeComponent.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
+#include "cybersouls/cybersouls.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Engine/World.h"
@@ -14,7 +19,18 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "GameFramework/PlayerStart.h"
-#include "EngineUtils.h"
+#include "InputMappingContext.h"
+
+DECLARE_CYCLE_STAT(TEXT("Character Switch"), STAT_CharacterSwitch, STATGROUP_Cybersouls);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Character Switch Latency (ms)"), STAT_CharacterSwitchLatency, STATGROUP_Cybersouls);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Character Switch Latency (frames)"), STAT_CharacterSwitchFrames, STATGROUP_Cybersouls);
+
+namespace
+{
+    // Controller context is added at 1, above both characters
+    constexpr int32 ActiveCharacterContextPriority = 0;
+    constexpr int32 InactiveCharacterContextPriority = -1;
+}
 
 ACyberSoulsPlayerController::ACyberSoulsPlayerController()
 {
@@ -166,6 +182,7 @@ void ACyberSoulsPlayerController::InitializeCharacterPool()
         
         DefaultChar->SetActorLocation(InitialLocation);
         DefaultChar->SetActorRotation(InitialRotation);
+        InitialPlayerTransform = FTransform(InitialRotation, InitialLocation);
         
         Possess(DefaultChar);
     }
@@ -174,6 +191,9 @@ void ACyberSoulsPlayerController::InitializeCharacterPool()
         UE_LOG(LogTemp, Error, TEXT("PLAYER CONTROLLER: Failed to get Default Character from pool!"));
     }
     
+    // Register both characters' contexts once, switching only reorders them
+    ApplyCharacterMappingPriorities();
+    
     // Initialize state structs
     DefaultCharacterState.bIsValid = false;
     CyberStateCharacterState.bIsValid = false;
@@ -181,149 +201,228 @@ void ACyberSoulsPlayerController::InitializeCharacterPool()
     UE_LOG(LogTemp, Warning, TEXT("PLAYER CONTROLLER: Character pool initialization complete"));
 }
 
-void ACyberSoulsPlayerController::SwitchCharacter()
+bool ACyberSoulsPlayerController::ResetForLevelRestart()
 {
-    UE_LOG(LogTemp, Warning, TEXT("PLAYER CONTROLLER: SwitchCharacter() called!"));
+    if (!CharacterPool || !CharacterPool->GetInactiveCharacter(false))
+    {
+        return false;
+    }
+    
+    // Whichever character is active, start over on the default one
+    UnPossess();
+    CharacterPool->ResetPool();
+    bIsUsingCyberState = false;
+    DefaultCharacterState.bIsValid = false;
+    CyberStateCharacterState.bIsValid = false;
+    
+    ResetCharacterForRestart(CharacterPool->GetInactiveCharacter(true));
+    
+    ACharacter* DefaultChar = CharacterPool->GetInactiveCharacter(false);
+    ResetCharacterForRestart(DefaultChar);
+    DefaultChar->SetActorTransform(InitialPlayerTransform, false, nullptr, ETeleportType::ResetPhysics);
+    SetControlRotation(InitialPlayerTransform.Rotator());
+    Possess(DefaultChar);
+    
+    // Death disables the character's input
+    DefaultChar->EnableInput(this);
     
-    UE_LOG(LogTemp, Warning, TEXT("PLAYER CONTROLLER: Current state: %s"), 
-        bIsUsingCyberState ? TEXT("CyberState") : TEXT("Default"));
+    ApplyCharacterMappingPriorities();
+    BroadcastCharacterSwitched(DefaultChar);
     
-    if (bIsUsingCyberState)
+    return true;
+}
+
+ACharacter* ACyberSoulsPlayerController::GetPooledCharacter(bool bCyberState) const
+{
+    return CharacterPool ? CharacterPool->GetInactiveCharacter(bCyberState) : nullptr;
+}
+
+bool ACyberSoulsPlayerController::RestoreActiveCharacter(bool bCyberState, const FTransform& Transform, const FRotator& ControlRotation)
+{
+    if (!CharacterPool || !GetPooledCharacter(bCyberState))
     {
-        SwitchToDefaultCharacter();
+        return false;
     }
-    else
+    
+    if (bIsUsingCyberState != bCyberState)
+    {
+        SwitchToCharacter(bCyberState);
+    }
+    
+    ACharacter* ActiveChar = Cast<ACharacter>(GetPawn());
+    if (!ActiveChar)
+    {
+        return false;
+    }
+    
+    ActiveChar->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+    SetControlRotation(ControlRotation);
+    
+    if (UCharacterMovementComponent* Movement = ActiveChar->GetCharacterMovement())
     {
-        SwitchToCyberStateCharacter();
+        Movement->StopMovementImmediately();
+    }
+    
+    // Death disables the character's input
+    ActiveChar->EnableInput(this);
+    
+    return true;
+}
+
+void ACyberSoulsPlayerController::ResetCharacterForRestart(ACharacter* Character)
+{
+    if (!IsValid(Character))
+    {
+        return;
+    }
+    
+    if (UPlayerAttributeComponent* PlayerAttributes = Character->FindComponentByClass<UPlayerAttributeComponent>())
+    {
+        PlayerAttributes->ResetAttributes();
+    }
+    
+    if (UPlayerCyberStateAttributeComponent* CyberStateAttributes = Character->FindComponentByClass<UPlayerCyberStateAttributeComponent>())
+    {
+        CyberStateAttributes->ResetStamina();
+    }
+    
+    if (UStatusEffectComponent* StatusEffects = Character->FindComponentByClass<UStatusEffectComponent>())
+    {
+        StatusEffects->ClearAllEffects();
+    }
+    
+    Character->ForEachComponent<UBaseAbilityComponent>(false, [](UBaseAbilityComponent* Ability)
+    {
+        Ability->ResetAbility();
+    });
+    
+    if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+    {
+        Movement->StopMovementImmediately();
     }
 }
 
-void ACyberSoulsPlayerController::SwitchToDefaultCharacter()
+void ACyberSoulsPlayerController::SwitchCharacter()
+{
+    SCOPE_CYCLE_COUNTER(STAT_CharacterSwitch);
+    
+    SwitchStartCycles = FPlatformTime::Cycles64();
+    SwitchStartFrame = GFrameCounter;
+    bSwitchLatencyPending = true;
+    
+    SwitchToCharacter(!bIsUsingCyberState);
+}
+
+void ACyberSoulsPlayerController::SwitchToCharacter(bool bCyberState)
 {
     if (!CharacterPool)
     {
-        UE_LOG(LogTemp, Error, TEXT("SwitchToDefaultCharacter: CharacterPool is NULL"));
+        UE_LOG(LogTemp, Error, TEXT("SwitchToCharacter: CharacterPool is NULL"));
+        bSwitchLatencyPending = false;
         return;
     }
     
     APawn* CurrentPawn = GetPawn();
     if (!CurrentPawn)
     {
-        UE_LOG(LogTemp, Error, TEXT("SwitchToDefaultCharacter: No current pawn"));
+        UE_LOG(LogTemp, Error, TEXT("SwitchToCharacter: No current pawn"));
+        bSwitchLatencyPending = false;
         return;
     }
     
     // Store current state
     StoreCharacterState(CurrentPawn);
-    FVector CharacterLocation = CurrentPawn->GetActorLocation();
-    FRotator CharacterRotation = CurrentPawn->GetActorRotation();
+    const FVector CharacterLocation = CurrentPawn->GetActorLocation();
+    const FRotator CharacterRotation = CurrentPawn->GetActorRotation();
     
-    // Clear all input mapping contexts before switching
-    if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
-    {
-        Subsystem->ClearAllMappings();
-        
-        // Re-add controller mapping context with higher priority
-        if (ControllerMappingContext)
-        {
-            Subsystem->AddMappingContext(ControllerMappingContext, 1);
-        }
-    }
-    
-    // Unpossess current character
+    // Both mapping contexts stay registered, possession swaps the input component
     UnPossess();
-    
-    // Return cyber state character to pool
     CharacterPool->ReturnCharacter(Cast<ACharacter>(CurrentPawn));
     
-    // Get default character from pool
-    if (ACharacter* DefaultChar = CharacterPool->GetCharacter(false))
+    ACharacter* NewChar = CharacterPool->GetCharacter(bCyberState);
+    if (!NewChar)
     {
-        DefaultChar->SetActorLocation(CharacterLocation);
-        DefaultChar->SetActorRotation(CharacterRotation);
-        RestoreCharacterState(DefaultChar);
-        Possess(DefaultChar);
-        
-        bIsUsingCyberState = false;
-        OnCharacterSwitched.Broadcast(DefaultChar);
-        
-        // Update all AI controllers to track the new player character
-        UpdateAllAIControllers();
-        
-        // Show HUD notification
-        if (ACybersoulsHUD* CyberHUD = Cast<ACybersoulsHUD>(GetHUD()))
-        {
-            CyberHUD->ShowCharacterSwitchNotification(TEXT("▰▰ SWITCHED TO DEFAULT MODE ▰▰"));
-        }
+        UE_LOG(LogTemp, Error, TEXT("SwitchToCharacter: Failed to get %s character from pool"),
+            bCyberState ? TEXT("cyber state") : TEXT("default"));
+        bSwitchLatencyPending = false;
+        return;
     }
-    else
+    
+    NewChar->SetActorLocation(CharacterLocation);
+    NewChar->SetActorRotation(CharacterRotation);
+    RestoreCharacterState(NewChar);
+    Possess(NewChar);
+    
+    bIsUsingCyberState = bCyberState;
+    ApplyCharacterMappingPriorities();
+    BroadcastCharacterSwitched(NewChar);
+    
+    // Show HUD notification
+    if (ACybersoulsHUD* CyberHUD = Cast<ACybersoulsHUD>(GetHUD()))
     {
-        UE_LOG(LogTemp, Error, TEXT("SwitchToDefaultCharacter: Failed to get default character from pool"));
+        CyberHUD->ShowCharacterSwitchNotification(bCyberState ? TEXT("▰▰ SWITCHED TO CYBER STATE ▰▰") : TEXT("▰▰ SWITCHED TO DEFAULT MODE ▰▰"));
     }
 }
 
-void ACyberSoulsPlayerController::SwitchToCyberStateCharacter()
+void ACyberSoulsPlayerController::ApplyCharacterMappingPriorities()
 {
     if (!CharacterPool)
     {
-        UE_LOG(LogTemp, Error, TEXT("SwitchToCyberStateCharacter: CharacterPool is NULL"));
         return;
     }
     
-    APawn* CurrentPawn = GetPawn();
-    if (!CurrentPawn)
+    UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer());
+    if (!Subsystem)
     {
-        UE_LOG(LogTemp, Error, TEXT("SwitchToCyberStateCharacter: No current pawn"));
         return;
     }
     
-    // Store current state
-    StoreCharacterState(CurrentPawn);
-    FVector CharacterLocation = CurrentPawn->GetActorLocation();
-    FRotator CharacterRotation = CurrentPawn->GetActorRotation();
-    
-    // Clear all input mapping contexts before switching
-    if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
+    // Re-adding a registered context only moves it, the mappings are rebuilt once at the end of the frame
+    // instead of after every clear and add. The inactive context sits below the active one so shared keys
+    // go to the active character; its bindings have no input component to fire on once it is unpossessed.
+    if (AcybersoulsCharacter* DefaultChar = Cast<AcybersoulsCharacter>(CharacterPool->GetInactiveCharacter(false)))
     {
-        Subsystem->ClearAllMappings();
-        
-        // Re-add controller mapping context with higher priority
-        if (ControllerMappingContext)
+        if (UInputMappingContext* DefaultContext = DefaultChar->GetDefaultMappingContext())
         {
-            Subsystem->AddMappingContext(ControllerMappingContext, 1);
+            Subsystem->AddMappingContext(DefaultContext, bIsUsingCyberState ? InactiveCharacterContextPriority : ActiveCharacterContextPriority);
         }
     }
     
-    // Unpossess current character
-    UnPossess();
-    
-    // Return default character to pool
-    CharacterPool->ReturnCharacter(Cast<ACharacter>(CurrentPawn));
-    
-    // Get cyber state character from pool
-    if (ACharacter* CyberStateChar = CharacterPool->GetCharacter(true))
+    if (APlayerCyberState* CyberStateChar = Cast<APlayerCyberState>(CharacterPool->GetInactiveCharacter(true)))
     {
-        CyberStateChar->SetActorLocation(CharacterLocation);
-        CyberStateChar->SetActorRotation(CharacterRotation);
-        RestoreCharacterState(CyberStateChar);
-        Possess(CyberStateChar);
-        
-        bIsUsingCyberState = true;
-        OnCharacterSwitched.Broadcast(CyberStateChar);
-        
-        // Update all AI controllers to track the new player character
-        UpdateAllAIControllers();
-        
-        // Show HUD notification
-        if (ACybersoulsHUD* CyberHUD = Cast<ACybersoulsHUD>(GetHUD()))
+        if (CyberStateChar->CyberStateMappingContext)
         {
-            CyberHUD->ShowCharacterSwitchNotification(TEXT("▰▰ SWITCHED TO CYBER STATE ▰▰"));
+            Subsystem->AddMappingContext(CyberStateChar->CyberStateMappingContext, bIsUsingCyberState ? ActiveCharacterContextPriority : InactiveCharacterContextPriority);
         }
     }
-    else
+}
+
+void ACyberSoulsPlayerController::BroadcastCharacterSwitched(APawn* NewCharacter)
+{
+    OnCharacterSwitched.Broadcast(NewCharacter);
+    OnCharacterSwitchedNative.Broadcast(NewCharacter);
+}
+
+void ACyberSoulsPlayerController::PlayerTick(float DeltaTime)
+{
+    // Input is processed at the start of PlayerTick, so the first one in a later frame reaches the new character
+    if (bSwitchLatencyPending && GFrameCounter > SwitchStartFrame)
     {
-        UE_LOG(LogTemp, Error, TEXT("SwitchToCyberStateCharacter: Failed to get cyber state character from pool"));
+        bSwitchLatencyPending = false;
+        LastSwitchLatencyMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SwitchStartCycles));
+        const uint32 LatencyFrames = static_cast<uint32>(GFrameCounter - SwitchStartFrame);
+        
+        SET_FLOAT_STAT(STAT_CharacterSwitchLatency, LastSwitchLatencyMs);
+        SET_DWORD_STAT(STAT_CharacterSwitchFrames, LatencyFrames);
+        
+        // One frame is the target
+        if (LatencyFrames > 1)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Character switch took %u frames (%.2f ms)"), LatencyFrames, LastSwitchLatencyMs);
+        }
     }
+    
+    Super::PlayerTick(DeltaTime);
 }
 
 void ACyberSoulsPlayerController::TransferCameraSettings(APawn* FromPawn, APawn* ToPawn)
@@ -490,25 +589,4 @@ void ACyberSoulsPlayerController::HandleOpenInventoryInput()
     // Note: This function is kept for compatibility but E key functionality has been moved to Tab
     // The actual inventory is now opened via HandleShowXPInput (Tab key)
     UE_LOG(LogTemp, Warning, TEXT("HandleOpenInventoryInput: E key pressed (legacy - use Tab instead)"));
-}
-
-void ACyberSoulsPlayerController::UpdateAllAIControllers()
-{
-    UWorld* World = GetWorld();
-    if (!World)
-    {
-        return;
-    }
-    
-    // Find all AI controllers and update their player targets
-    for (TActorIterator<ABaseEnemyAIController> ActorIterator(World); ActorIterator; ++ActorIterator)
-    {
-        ABaseEnemyAIController* AIController = *ActorIterator;
-        if (IsValid(AIController))
-        {
-            AIController->UpdatePlayerTarget();
-        }
-    }
-    
-    UE_LOG(LogTemp, Warning, TEXT("Updated all AI controllers to track new player character"));
 }
\ No newline at end of file
@@ -223,6 +223,17 @@ void UDashAbilityComponent::ResetCharges()
     ChargeRegenTimer = 0.0f;
 }
 
+void UDashAbilityComponent::ResetAbility()
+{
+    if (bIsDashing)
+    {
+        DeactivateAbility();
+    }
+
+    Super::ResetAbility();
+    ResetCharges();
+}
+
 void UDashAbilityComponent::DeactivateAbility()
 {
     if (bIsDashing)
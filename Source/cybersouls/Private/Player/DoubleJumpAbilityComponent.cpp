@@ -91,6 +91,12 @@ void UDoubleJumpAbilityComponent::ResetJumpCount()
     CurrentJumpsInAir = 0;
 }
 
+void UDoubleJumpAbilityComponent::ResetAbility()
+{
+    Super::ResetAbility();
+    ResetJumpCount();
+}
+
 void UDoubleJumpAbilityComponent::OnMovementModeChanged(ACharacter* Character, EMovementMode PrevMovementMode, uint8 PreviousCustomMode)
 {
     if (Character == OwnerCharacter)
@@ -24,6 +24,20 @@ void UPlayerCyberStateAttributeComponent::TickComponent(float DeltaTime, ELevelT
     }
 }
 
+void UPlayerCyberStateAttributeComponent::ResetStamina()
+{
+    CurrentStamina = MaxStamina;
+    TimeSinceLastStaminaUse = 0.0f;
+    OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+}
+
+void UPlayerCyberStateAttributeComponent::SetCurrentStamina(float NewStamina)
+{
+    CurrentStamina = FMath::Clamp(NewStamina, 0.0f, MaxStamina);
+    TimeSinceLastStaminaUse = 0.0f;
+    OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+}
+
 void UPlayerCyberStateAttributeComponent::UseStamina(float Amount)
 {
     if (Amount <= 0.0f) return;
@@ -0,0 +1,695 @@
+#include "cybersouls/Public/SaveGame/CheckpointSubsystem.h"
+#include "cybersouls/Public/Abilities/BlockAbilityComponent.h"
+#include "cybersouls/Public/Abilities/DodgeAbilityComponent.h"
+#include "cybersouls/Public/Abilities/QuickHackComponent.h"
+#include "cybersouls/Public/Abilities/QuickHackManagerComponent.h"
+#include "cybersouls/Public/Attributes/EnemyAttributeComponent.h"
+#include "cybersouls/Public/Attributes/PlayerAttributeComponent.h"
+#include "cybersouls/Public/Combat/StatusEffectComponent.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/DebrisPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/EnemyPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "cybersouls/Public/Game/cybersoulsGameMode.h"
+#include "cybersouls/Public/Player/CyberSoulsPlayerController.h"
+#include "cybersouls/Public/Player/PlayerCyberStateAttributeComponent.h"
+#include "cybersouls/Public/SaveGame/CrashSafeFile.h"
+#include "cybersouls/Public/UI/CybersoulsHUD.h"
+#include "cybersouls/cybersouls.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Checkpoint Capture"), STAT_CheckpointCapture, STATGROUP_Cybersouls);
+DECLARE_CYCLE_STAT(TEXT("Checkpoint Apply"), STAT_CheckpointApply, STATGROUP_Cybersouls);
+
+namespace CheckpointFormat
+{
+    // "CSCP"
+    constexpr uint32 Magic = 0x50435343;
+
+    // Bump whenever the payload layout changes, files of another version are ignored
+    constexpr uint16 Version = 2;
+
+    // Far above any real checkpoint, stops a corrupt header from sizing a huge allocation
+    constexpr int32 MaxPayloadSize = 16 * 1024 * 1024;
+
+    constexpr uint8 FlagCompressed = 1 << 0;
+
+    // QuickHack targets, anything else is an index into FCheckpointData::Enemies
+    constexpr int16 TargetNone = -1;
+    constexpr int16 TargetPlayer = -2;
+    constexpr int16 TargetSelf = -3;
+
+    // Parts a player character record carries
+    constexpr uint8 HasAttributes = 1 << 0;
+    constexpr uint8 HasStamina = 1 << 1;
+    constexpr uint8 HasQuickHacks = 1 << 2;
+}
+
+struct FCheckpointQuickHack
+{
+    int16 Target = CheckpointFormat::TargetNone;
+    float CooldownRemaining = 0.0f;
+    float CastElapsed = 0.0f;
+
+    friend FArchive& operator<<(FArchive& Ar, FCheckpointQuickHack& QuickHack)
+    {
+        Ar << QuickHack.Target << QuickHack.CooldownRemaining;
+
+        // Cast progress is only stored mid-cast
+        if (QuickHack.Target != CheckpointFormat::TargetNone)
+        {
+            Ar << QuickHack.CastElapsed;
+        }
+        return Ar;
+    }
+};
+
+struct FCheckpointPlayerCharacter
+{
+    uint8 Parts = 0;
+    float Integrity = 0.0f;
+    float HackProgress = 0.0f;
+    float Stamina = 0.0f;
+
+    // One per QuickHack slot
+    TArray<FCheckpointQuickHack> QuickHacks;
+
+    friend FArchive& operator<<(FArchive& Ar, FCheckpointPlayerCharacter& Character)
+    {
+        Ar << Character.Parts;
+        if (Character.Parts & CheckpointFormat::HasAttributes)
+        {
+            Ar << Character.Integrity << Character.HackProgress;
+        }
+        if (Character.Parts & CheckpointFormat::HasStamina)
+        {
+            Ar << Character.Stamina;
+        }
+        if (Character.Parts & CheckpointFormat::HasQuickHacks)
+        {
+            Ar << Character.QuickHacks;
+        }
+        return Ar;
+    }
+};
+
+struct FCheckpointEnemy
+{
+    // Into FCheckpointData::EnemyClasses
+    uint16 ClassIndex = 0;
+
+    // Enemies stand upright, yaw is the only rotation that matters
+    FVector3f Location = FVector3f::ZeroVector;
+    float Yaw = 0.0f;
+
+    float Integrity = 0.0f;
+
+    // -1 when the enemy has no such ability
+    int8 BlockCharges = -1;
+    int8 DodgeCharges = -1;
+
+    // Same order as ACybersoulsEnemyBase::GetQuickHacks
+    TArray<FCheckpointQuickHack> QuickHacks;
+
+    friend FArchive& operator<<(FArchive& Ar, FCheckpointEnemy& Enemy)
+    {
+        Ar << Enemy.ClassIndex << Enemy.Location << Enemy.Yaw << Enemy.Integrity;
+        Ar << Enemy.BlockCharges << Enemy.DodgeCharges << Enemy.QuickHacks;
+        return Ar;
+    }
+};
+
+struct FCheckpointData
+{
+    FString MapName;
+
+    uint8 bHasPlayer = 0;
+    uint8 bUsingCyberState = 0;
+    FVector3f PlayerLocation = FVector3f::ZeroVector;
+    FRotator3f PlayerRotation = FRotator3f::ZeroRotator;
+    FRotator3f ControlRotation = FRotator3f::ZeroRotator;
+
+    // Default character first, then the CyberState one
+    static constexpr int32 NumCharacters = 2;
+    FCheckpointPlayerCharacter Characters[NumCharacters];
+
+    // Class paths written once, enemies refer to them by index
+    TArray<FString> EnemyClasses;
+    TArray<FCheckpointEnemy> Enemies;
+
+    void Serialize(FArchive& Ar)
+    {
+        Ar << MapName << bHasPlayer;
+        if (bHasPlayer)
+        {
+            Ar << bUsingCyberState << PlayerLocation << PlayerRotation << ControlRotation;
+            Ar << Characters[0] << Characters[1];
+        }
+        Ar << EnemyClasses << Enemies;
+    }
+};
+
+UCheckpointSubsystem* UCheckpointSubsystem::Get(const UObject* WorldContextObject)
+{
+    if (!GEngine)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+    return World ? World->GetSubsystem<UCheckpointSubsystem>() : nullptr;
+}
+
+void UCheckpointSubsystem::Deinitialize()
+{
+    if (WriteTask.IsValid())
+    {
+        WriteTask.Wait();
+    }
+    LatestPayload.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UCheckpointSubsystem::SaveCheckpoint()
+{
+    if (!GetWorld())
+    {
+        return false;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    FCheckpointData Data;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_CheckpointCapture);
+        CaptureCheckpoint(Data);
+
+        LatestPayload.Reset();
+        FMemoryWriter Writer(LatestPayload);
+        Data.Serialize(Writer);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Checkpoint: Captured %d enemies into %d bytes in %.2f ms"),
+        Data.Enemies.Num(), LatestPayload.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    // The task owns its copy, the next checkpoint can overwrite LatestPayload straight away
+    auto WriteFile = [Payload = LatestPayload, Path = GetCheckpointPath(), bCompress = bCompressCheckpoints]() mutable
+    {
+        uint8 Flags = 0;
+        TArray<uint8> Compressed;
+        if (bCompress)
+        {
+            int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Payload.Num());
+            Compressed.SetNumUninitialized(CompressedSize);
+            if (FCompression::CompressMemory(NAME_Oodle, Compressed.GetData(), CompressedSize, Payload.GetData(), Payload.Num()) && CompressedSize < Payload.Num())
+            {
+                Compressed.SetNum(CompressedSize);
+                Flags |= CheckpointFormat::FlagCompressed;
+            }
+        }
+
+        TArray<uint8> FileBytes;
+        FMemoryWriter Writer(FileBytes);
+        uint32 Magic = CheckpointFormat::Magic;
+        uint16 Version = CheckpointFormat::Version;
+        int32 UncompressedSize = Payload.Num();
+        uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+        Writer << Magic << Version << Flags << UncompressedSize << PayloadCrc;
+
+        TArray<uint8>& Body = (Flags & CheckpointFormat::FlagCompressed) ? Compressed : Payload;
+        Writer.Serialize(Body.GetData(), Body.Num());
+
+        // A crash mid-write keeps the previous checkpoint, ReadCheckpointFile recovers an interrupted swap
+        if (!FCrashSafeFile::Write(FileBytes, Path))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Checkpoint: Failed to write %s"), *Path);
+        }
+    };
+
+    // Chained so an older checkpoint never lands on top of a newer one
+    if (WriteTask.IsValid() && !WriteTask.IsCompleted())
+    {
+        WriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteFile), UE::Tasks::Prerequisites(WriteTask));
+    }
+    else
+    {
+        WriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteFile));
+    }
+
+    return true;
+}
+
+bool UCheckpointSubsystem::LoadCheckpoint()
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<uint8> FilePayload;
+    const TArray<uint8>* Payload = &LatestPayload;
+    if (LatestPayload.Num() == 0)
+    {
+        if (!ReadCheckpointFile(FilePayload))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Checkpoint: Nothing to load"));
+            return false;
+        }
+        Payload = &FilePayload;
+    }
+
+    FCheckpointData Data;
+    FMemoryReader Reader(*Payload);
+    Data.Serialize(Reader);
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Checkpoint: Payload is corrupt"));
+        return false;
+    }
+
+    if (Data.MapName != UGameplayStatics::GetCurrentLevelName(this))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Checkpoint: Saved on %s, not loading it here"), *Data.MapName);
+        return false;
+    }
+
+    bool bApplied = false;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_CheckpointApply);
+        bApplied = ApplyCheckpoint(Data);
+    }
+
+    if (bApplied)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Checkpoint: Restored %d enemies in %.2f ms"),
+            Data.Enemies.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    return bApplied;
+}
+
+bool UCheckpointSubsystem::HasCheckpoint() const
+{
+    // A lone temp file is a complete checkpoint whose rename was interrupted
+    const FString Path = GetCheckpointPath();
+    return LatestPayload.Num() > 0 || IFileManager::Get().FileExists(*Path) || IFileManager::Get().FileExists(*FCrashSafeFile::GetTempPath(Path));
+}
+
+FString UCheckpointSubsystem::GetCheckpointPath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / CheckpointFileName;
+}
+
+void UCheckpointSubsystem::CaptureCheckpoint(FCheckpointData& Data) const
+{
+    Data.MapName = UGameplayStatics::GetCurrentLevelName(this);
+
+    UWorld* World = GetWorld();
+    ACyberSoulsPlayerController* CyberPC = Cast<ACyberSoulsPlayerController>(World->GetFirstPlayerController());
+    APawn* PlayerPawn = CyberPC ? CyberPC->GetPawn() : nullptr;
+
+    // Dying enemies finish their death sequence rather than coming back
+    TArray<ACybersoulsEnemyBase*> Enemies;
+    if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+    {
+        Enemies.Reserve(Registry->GetLiveEnemies().Num());
+        for (ACybersoulsEnemyBase* Enemy : Registry->GetLiveEnemies())
+        {
+            if (IsValid(Enemy) && !Enemy->IsDead() && Enemies.Num() < MAX_int16)
+            {
+                Enemies.Add(Enemy);
+            }
+        }
+    }
+
+    // Indices are known up front so casts can point at enemies written later
+    TMap<const AActor*, int16> EnemyIndices;
+    EnemyIndices.Reserve(Enemies.Num());
+    for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+    {
+        EnemyIndices.Add(Enemies[Index], static_cast<int16>(Index));
+    }
+
+    auto CaptureQuickHack = [&EnemyIndices, PlayerPawn](const UQuickHackComponent* QuickHack, FCheckpointQuickHack& Out)
+    {
+        Out.CooldownRemaining = QuickHack->GetCooldownRemaining();
+
+        const AActor* Target = QuickHack->IsQuickHackActive() ? QuickHack->GetCurrentTarget() : nullptr;
+        if (!Target)
+        {
+            return;
+        }
+
+        if (Target == QuickHack->GetOwner())
+        {
+            Out.Target = CheckpointFormat::TargetSelf;
+        }
+        else if (Target == PlayerPawn)
+        {
+            Out.Target = CheckpointFormat::TargetPlayer;
+        }
+        else if (const int16* EnemyIndex = EnemyIndices.Find(Target))
+        {
+            Out.Target = *EnemyIndex;
+        }
+        else
+        {
+            // Target is gone, the cast would be interrupted anyway
+            return;
+        }
+
+        Out.CastElapsed = QuickHack->GetCastElapsed();
+    };
+
+    if (CyberPC && PlayerPawn)
+    {
+        Data.bHasPlayer = 1;
+        Data.bUsingCyberState = CyberPC->IsUsingCyberState() ? 1 : 0;
+        Data.PlayerLocation = FVector3f(PlayerPawn->GetActorLocation());
+        Data.PlayerRotation = FRotator3f(PlayerPawn->GetActorRotation());
+        Data.ControlRotation = FRotator3f(CyberPC->GetControlRotation());
+
+        for (int32 CharacterIndex = 0; CharacterIndex < FCheckpointData::NumCharacters; ++CharacterIndex)
+        {
+            const ACharacter* Character = CyberPC->GetPooledCharacter(CharacterIndex == 1);
+            if (!Character)
+            {
+                continue;
+            }
+
+            FCheckpointPlayerCharacter& Out = Data.Characters[CharacterIndex];
+
+            if (const UPlayerAttributeComponent* Attributes = Character->FindComponentByClass<UPlayerAttributeComponent>())
+            {
+                Out.Parts |= CheckpointFormat::HasAttributes;
+                Out.Integrity = Attributes->Integrity;
+                Out.HackProgress = Attributes->HackProgress;
+            }
+
+            if (const UPlayerCyberStateAttributeComponent* CyberStateAttributes = Character->FindComponentByClass<UPlayerCyberStateAttributeComponent>())
+            {
+                Out.Parts |= CheckpointFormat::HasStamina;
+                Out.Stamina = CyberStateAttributes->GetCurrentStamina();
+            }
+
+            if (const UQuickHackManagerComponent* QuickHackManager = Character->FindComponentByClass<UQuickHackManagerComponent>())
+            {
+                Out.Parts |= CheckpointFormat::HasQuickHacks;
+                Out.QuickHacks.SetNum(UQuickHackManagerComponent::MAX_QUICKHACK_SLOTS);
+                for (int32 Slot = 1; Slot <= UQuickHackManagerComponent::MAX_QUICKHACK_SLOTS; ++Slot)
+                {
+                    if (const UQuickHackComponent* QuickHack = QuickHackManager->GetQuickHackInstance(Slot))
+                    {
+                        CaptureQuickHack(QuickHack, Out.QuickHacks[Slot - 1]);
+                    }
+                }
+            }
+        }
+    }
+
+    TMap<const UClass*, uint16> ClassIndices;
+    Data.Enemies.SetNum(Enemies.Num());
+    for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+    {
+        const ACybersoulsEnemyBase* Enemy = Enemies[Index];
+        FCheckpointEnemy& Out = Data.Enemies[Index];
+
+        const UClass* EnemyClass = Enemy->GetClass();
+        if (const uint16* ClassIndex = ClassIndices.Find(EnemyClass))
+        {
+            Out.ClassIndex = *ClassIndex;
+        }
+        else
+        {
+            Out.ClassIndex = static_cast<uint16>(Data.EnemyClasses.Add(EnemyClass->GetPathName()));
+            ClassIndices.Add(EnemyClass, Out.ClassIndex);
+        }
+
+        Out.Location = FVector3f(Enemy->GetActorLocation());
+        Out.Yaw = static_cast<float>(Enemy->GetActorRotation().Yaw);
+
+        if (const UEnemyAttributeComponent* Attributes = Enemy->GetEnemyAttributes())
+        {
+            Out.Integrity = Attributes->Integrity;
+        }
+
+        if (const UBlockAbilityComponent* Block = Enemy->GetBlockAbility())
+        {
+            Out.BlockCharges = static_cast<int8>(FMath::Clamp(Block->CurrentBlockCharges, 0, MAX_int8));
+        }
+
+        if (const UDodgeAbilityComponent* Dodge = Enemy->GetDodgeAbility())
+        {
+            Out.DodgeCharges = static_cast<int8>(FMath::Clamp(Dodge->CurrentDodgeCharges, 0, MAX_int8));
+        }
+
+        const TArray<UQuickHackComponent*>& QuickHacks = Enemy->GetQuickHacks();
+        Out.QuickHacks.SetNum(QuickHacks.Num());
+        for (int32 QuickHackIndex = 0; QuickHackIndex < QuickHacks.Num(); ++QuickHackIndex)
+        {
+            if (QuickHacks[QuickHackIndex])
+            {
+                CaptureQuickHack(QuickHacks[QuickHackIndex], Out.QuickHacks[QuickHackIndex]);
+            }
+        }
+    }
+}
+
+bool UCheckpointSubsystem::ApplyCheckpoint(const FCheckpointData& Data)
+{
+    UWorld* World = GetWorld();
+    UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this);
+    ACyberSoulsPlayerController* CyberPC = World ? Cast<ACyberSoulsPlayerController>(World->GetFirstPlayerController()) : nullptr;
+    if (!EnemyPool)
+    {
+        return false;
+    }
+
+    // Player first, it is the only step that can refuse before the world has changed
+    if (Data.bHasPlayer)
+    {
+        const FTransform PlayerTransform(FRotator(Data.PlayerRotation), FVector(Data.PlayerLocation));
+        if (!CyberPC || !CyberPC->RestoreActiveCharacter(Data.bUsingCyberState != 0, PlayerTransform, FRotator(Data.ControlRotation)))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Checkpoint: Player could not be restored"));
+            return false;
+        }
+    }
+
+    if (UDebrisPoolSubsystem* DebrisPool = UDebrisPoolSubsystem::Get(this))
+    {
+        DebrisPool->ReleaseAllPieces();
+    }
+
+    // Same cleanup as a soft reset, queued hits and cascade kills must not reach the restored enemies
+    if (AcybersoulsGameMode* GameMode = World ? World->GetAuthGameMode<AcybersoulsGameMode>() : nullptr)
+    {
+        GameMode->DiscardPendingCombat();
+    }
+
+    EnemyPool->ReleaseAllEnemies();
+
+    // Classes of live enemies are still loaded, so this only looks them up
+    TArray<UClass*> EnemyClasses;
+    EnemyClasses.Reserve(Data.EnemyClasses.Num());
+    for (const FString& ClassPath : Data.EnemyClasses)
+    {
+        EnemyClasses.Add(FSoftClassPath(ClassPath).TryLoadClass<ACybersoulsEnemyBase>());
+    }
+
+    TArray<ACybersoulsEnemyBase*> Enemies;
+    Enemies.Reserve(Data.Enemies.Num());
+    for (const FCheckpointEnemy& Saved : Data.Enemies)
+    {
+        UClass* EnemyClass = EnemyClasses.IsValidIndex(Saved.ClassIndex) ? EnemyClasses[Saved.ClassIndex] : nullptr;
+        const FTransform SpawnTransform(FRotator(0.0f, Saved.Yaw, 0.0f), FVector(Saved.Location));
+
+        ACybersoulsEnemyBase* Enemy = EnemyClass ? EnemyPool->SpawnEnemy(EnemyClass, SpawnTransform) : nullptr;
+        Enemies.Add(Enemy);
+        if (!Enemy)
+        {
+            continue;
+        }
+
+        if (UEnemyAttributeComponent* Attributes = Enemy->GetEnemyAttributes())
+        {
+            Attributes->Integrity = FMath::Min(Saved.Integrity, Attributes->MaxIntegrity);
+        }
+
+        UBlockAbilityComponent* Block = Enemy->GetBlockAbility();
+        if (Block && Saved.BlockCharges >= 0)
+        {
+            Block->CurrentBlockCharges = Saved.BlockCharges;
+        }
+
+        UDodgeAbilityComponent* Dodge = Enemy->GetDodgeAbility();
+        if (Dodge && Saved.DodgeCharges >= 0)
+        {
+            Dodge->CurrentDodgeCharges = Saved.DodgeCharges;
+        }
+    }
+
+    APawn* PlayerPawn = CyberPC ? CyberPC->GetPawn() : nullptr;
+    auto ResolveTarget = [&Enemies, PlayerPawn](int16 Target, AActor* Self) -> AActor*
+    {
+        switch (Target)
+        {
+            case CheckpointFormat::TargetNone:
+                return nullptr;
+            case CheckpointFormat::TargetPlayer:
+                return PlayerPawn;
+            case CheckpointFormat::TargetSelf:
+                return Self;
+            default:
+                return Enemies.IsValidIndex(Target) ? Enemies[Target] : nullptr;
+        }
+    };
+
+    // Casts go last, every enemy they may target exists by now
+    for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+    {
+        ACybersoulsEnemyBase* Enemy = Enemies[Index];
+        if (!Enemy)
+        {
+            continue;
+        }
+
+        const TArray<UQuickHackComponent*>& QuickHacks = Enemy->GetQuickHacks();
+        const TArray<FCheckpointQuickHack>& SavedQuickHacks = Data.Enemies[Index].QuickHacks;
+        const int32 NumQuickHacks = FMath::Min(QuickHacks.Num(), SavedQuickHacks.Num());
+        for (int32 QuickHackIndex = 0; QuickHackIndex < NumQuickHacks; ++QuickHackIndex)
+        {
+            const FCheckpointQuickHack& Saved = SavedQuickHacks[QuickHackIndex];
+            if (QuickHacks[QuickHackIndex])
+            {
+                QuickHacks[QuickHackIndex]->RestoreCheckpointState(Saved.CooldownRemaining, Saved.CastElapsed, ResolveTarget(Saved.Target, Enemy));
+            }
+        }
+    }
+
+    if (Data.bHasPlayer)
+    {
+        for (int32 CharacterIndex = 0; CharacterIndex < FCheckpointData::NumCharacters; ++CharacterIndex)
+        {
+            ACharacter* Character = CyberPC->GetPooledCharacter(CharacterIndex == 1);
+            if (!Character)
+            {
+                continue;
+            }
+
+            const FCheckpointPlayerCharacter& Saved = Data.Characters[CharacterIndex];
+
+            // Timed effects are not saved, so none should outlive the load
+            if (UStatusEffectComponent* StatusEffects = Character->FindComponentByClass<UStatusEffectComponent>())
+            {
+                StatusEffects->ClearAllEffects();
+            }
+
+            UPlayerAttributeComponent* Attributes = Character->FindComponentByClass<UPlayerAttributeComponent>();
+            if (Attributes && (Saved.Parts & CheckpointFormat::HasAttributes))
+            {
+                Attributes->Integrity = FMath::Clamp(Saved.Integrity, 0.0f, Attributes->MaxIntegrity);
+                Attributes->HackProgress = FMath::Clamp(Saved.HackProgress, 0.0f, Attributes->MaxHackProgress);
+                Attributes->OnIntegrityChanged.Broadcast(Attributes->Integrity);
+                Attributes->OnHackProgressChanged.Broadcast(Attributes->HackProgress);
+            }
+
+            UPlayerCyberStateAttributeComponent* CyberStateAttributes = Character->FindComponentByClass<UPlayerCyberStateAttributeComponent>();
+            if (CyberStateAttributes && (Saved.Parts & CheckpointFormat::HasStamina))
+            {
+                CyberStateAttributes->SetCurrentStamina(Saved.Stamina);
+            }
+
+            UQuickHackManagerComponent* QuickHackManager = Character->FindComponentByClass<UQuickHackManagerComponent>();
+            if (QuickHackManager && (Saved.Parts & CheckpointFormat::HasQuickHacks))
+            {
+                for (int32 Slot = 1; Slot <= Saved.QuickHacks.Num(); ++Slot)
+                {
+                    if (UQuickHackComponent* QuickHack = QuickHackManager->GetQuickHackInstance(Slot))
+                    {
+                        const FCheckpointQuickHack& SavedQuickHack = Saved.QuickHacks[Slot - 1];
+                        QuickHack->RestoreCheckpointState(SavedQuickHack.CooldownRemaining, SavedQuickHack.CastElapsed, ResolveTarget(SavedQuickHack.Target, Character));
+                    }
+                }
+            }
+        }
+
+        if (ACybersoulsHUD* CybersoulsHUD = Cast<ACybersoulsHUD>(CyberPC->GetHUD()))
+        {
+            CybersoulsHUD->ResetForLevelRestart();
+        }
+    }
+
+    return true;
+}
+
+bool UCheckpointSubsystem::ReadCheckpointFile(TArray<uint8>& OutPayload) const
+{
+    FCrashSafeFile::Recover(GetCheckpointPath());
+
+    TArray<uint8> FileBytes;
+    if (!FFileHelper::LoadFileToArray(FileBytes, *GetCheckpointPath(), FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(FileBytes);
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    uint8 Flags = 0;
+    int32 UncompressedSize = 0;
+    uint32 PayloadCrc = 0;
+    Reader << Magic << Version << Flags << UncompressedSize << PayloadCrc;
+
+    if (Reader.IsError() || Magic != CheckpointFormat::Magic || Version != CheckpointFormat::Version)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Checkpoint: %s is not a version %d checkpoint"), *GetCheckpointPath(), CheckpointFormat::Version);
+        return false;
+    }
+
+    if (UncompressedSize < 0 || UncompressedSize > CheckpointFormat::MaxPayloadSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Checkpoint: %s has a corrupt header"), *GetCheckpointPath());
+        return false;
+    }
+
+    const int32 BodyOffset = static_cast<int32>(Reader.Tell());
+    const int32 BodySize = FileBytes.Num() - BodyOffset;
+
+    if (Flags & CheckpointFormat::FlagCompressed)
+    {
+        OutPayload.SetNumUninitialized(UncompressedSize);
+        if (!FCompression::UncompressMemory(NAME_Oodle, OutPayload.GetData(), UncompressedSize, FileBytes.GetData() + BodyOffset, BodySize))
+        {
+            OutPayload.Reset();
+            return false;
+        }
+    }
+    else
+    {
+        if (BodySize != UncompressedSize)
+        {
+            return false;
+        }
+        OutPayload = TArray<uint8>(FileBytes.GetData() + BodyOffset, BodySize);
+    }
+
+    // Checked before FCheckpointData reads any array counts out of the payload
+    if (FCrc::MemCrc32(OutPayload.GetData(), OutPayload.Num()) != PayloadCrc)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Checkpoint: %s failed its checksum"), *GetCheckpointPath());
+        OutPayload.Reset();
+        return false;
+    }
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "cybersouls/Public/SaveGame/CrashSafeFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+bool FCrashSafeFile::Write(const TArray<uint8>& Bytes, const FString& Path)
+{
+    IFileManager& FileManager = IFileManager::Get();
+    const FString TempPath = GetTempPath(Path);
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+    {
+        FileManager.Delete(*TempPath, false, true, true);
+        return false;
+    }
+
+    // From here on the temp file is complete, Recover can finish the job
+    if (FileManager.FileExists(*Path) && !FileManager.Delete(*Path, false, true, true))
+    {
+        FileManager.Delete(*TempPath, false, true, true);
+        return false;
+    }
+
+    return FileManager.Move(*Path, *TempPath, true, true);
+}
+
+void FCrashSafeFile::Recover(const FString& Path)
+{
+    IFileManager& FileManager = IFileManager::Get();
+    const FString TempPath = GetTempPath(Path);
+
+    if (!FileManager.FileExists(*TempPath))
+    {
+        return;
+    }
+
+    if (FileManager.FileExists(*Path))
+    {
+        // The old file was never deleted, so the temp file may be torn
+        FileManager.Delete(*TempPath, false, true, true);
+        UE_LOG(LogTemp, Warning, TEXT("Discarded an unfinished write to %s"), *Path);
+    }
+    else if (FileManager.Move(*Path, *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Recovered %s from an interrupted write"), *Path);
+    }
+}
\ No newline at end of file
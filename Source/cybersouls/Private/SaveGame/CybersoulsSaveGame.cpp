@@ -7,4 +7,5 @@ UCybersoulsSaveGame::UCybersoulsSaveGame()
 {
     IntegrityXP = 0.0f;
     HackingXP = 0.0f;
+    JournalSequence = 0;
 }
\ No newline at end of file
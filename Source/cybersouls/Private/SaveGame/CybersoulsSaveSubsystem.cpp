@@ -0,0 +1,338 @@
+#include "cybersouls/Public/SaveGame/CybersoulsSaveSubsystem.h"
+#include "cybersouls/Public/SaveGame/CybersoulsSaveGame.h"
+#include "cybersouls/Public/SaveGame/CrashSafeFile.h"
+#include "cybersouls/cybersouls.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectGlobals.h"
+
+DECLARE_CYCLE_STAT(TEXT("Save Serialize"), STAT_SaveSerialize, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Saves Requested"), STAT_SavesRequested, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Saves Coalesced"), STAT_SavesCoalesced, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Journal Records"), STAT_JournalRecords, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Journal Compactions"), STAT_JournalCompactions, STATGROUP_Cybersouls);
+
+UCybersoulsSaveSubsystem* UCybersoulsSaveSubsystem::Get(const UObject* WorldContextObject)
+{
+    if (!GEngine)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UCybersoulsSaveSubsystem>() : nullptr;
+}
+
+void UCybersoulsSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Only a complete snapshot is ever renamed into the slot, finish that rename if a crash cut it short
+    FCrashSafeFile::Recover(GetSnapshotPath());
+
+    ProgressionState = LoadSnapshot();
+    if (!ProgressionState)
+    {
+        ProgressionState = Cast<UCybersoulsSaveGame>(UGameplayStatics::CreateSaveGameObject(UCybersoulsSaveGame::StaticClass()));
+    }
+
+    int32 NumReplayed = 0;
+    LastJournalSequence = Journal.Open(GetJournalPath(), ProgressionState->JournalSequence, [this, &NumReplayed](const FProgressionRecord& Record)
+    {
+        ApplyRecord(Record);
+        ++NumReplayed;
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("[XP LOAD] Replayed %d journaled changes on top of the progression snapshot"), NumReplayed);
+}
+
+void UCybersoulsSaveSubsystem::Deinitialize()
+{
+    if (Journal.Num() > 0)
+    {
+        CompactProgression();
+    }
+    FlushAndWait();
+    Journal.Close();
+
+    LatestSave = nullptr;
+    PendingSave = nullptr;
+    InFlightSave = nullptr;
+    ProgressionState = nullptr;
+
+    Super::Deinitialize();
+}
+
+void UCybersoulsSaveSubsystem::RequestSave(UCybersoulsSaveGame* SaveGame)
+{
+    if (!SaveGame)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_SavesRequested);
+    LatestSave = SaveGame;
+
+    if (bWriteInFlight)
+    {
+        // Only the newest state matters, drop whatever was waiting
+        if (PendingSave)
+        {
+            INC_DWORD_STAT(STAT_SavesCoalesced);
+        }
+        PendingSave = SaveGame;
+        return;
+    }
+
+    StartWrite(SaveGame);
+}
+
+bool UCybersoulsSaveSubsystem::FlushAndWait(float TimeoutSeconds)
+{
+    // The completion callback is queued to the game thread, so pump it while waiting
+    const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+    while (bWriteInFlight && FPlatformTime::Seconds() < Deadline)
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        if (bWriteInFlight)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+    }
+
+    if (bWriteInFlight)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[XP SAVE] Timed out waiting for a save to finish"));
+        return false;
+    }
+
+    if (UCybersoulsSaveGame* SaveGame = PendingSave)
+    {
+        PendingSave = nullptr;
+
+        TArray<uint8> Bytes;
+        bLastWriteSucceeded = UGameplayStatics::SaveGameToMemory(SaveGame, Bytes) && FCrashSafeFile::Write(Bytes, GetSnapshotPath());
+        HandleSaveWritten(SaveGame, bLastWriteSucceeded);
+    }
+
+    return bLastWriteSucceeded;
+}
+
+void UCybersoulsSaveSubsystem::RecordIntegrityXP(float Amount)
+{
+    FProgressionRecord Record;
+    Record.Type = EProgressionRecordType::IntegrityXP;
+    Record.Value = Amount;
+    AppendRecord(Record);
+}
+
+void UCybersoulsSaveSubsystem::RecordHackingXP(float Amount)
+{
+    FProgressionRecord Record;
+    Record.Type = EProgressionRecordType::HackingXP;
+    Record.Value = Amount;
+    AppendRecord(Record);
+}
+
+void UCybersoulsSaveSubsystem::RecordQuickHackUnlocked(EQuickHackType QuickHack)
+{
+    FProgressionRecord Record;
+    Record.Type = EProgressionRecordType::QuickHackUnlocked;
+    Record.QuickHack = static_cast<uint8>(QuickHack);
+    AppendRecord(Record);
+}
+
+void UCybersoulsSaveSubsystem::RecordQuickHackEquipped(int32 SlotIndex, EQuickHackType QuickHack)
+{
+    FProgressionRecord Record;
+    Record.Type = EProgressionRecordType::QuickHackEquipped;
+    Record.Slot = static_cast<uint8>(SlotIndex);
+    Record.QuickHack = static_cast<uint8>(QuickHack);
+    AppendRecord(Record);
+}
+
+void UCybersoulsSaveSubsystem::RecordProgressionReset()
+{
+    FProgressionRecord Record;
+    Record.Type = EProgressionRecordType::Reset;
+    AppendRecord(Record);
+}
+
+void UCybersoulsSaveSubsystem::CompactProgression()
+{
+    if (!ProgressionState)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_JournalCompactions);
+
+    // The state keeps changing while the snapshot is written, so save a copy
+    UCybersoulsSaveGame* Snapshot = DuplicateObject<UCybersoulsSaveGame>(ProgressionState, this);
+    Snapshot->JournalSequence = LastJournalSequence;
+    RequestSave(Snapshot);
+}
+
+void UCybersoulsSaveSubsystem::AppendRecord(FProgressionRecord& Record)
+{
+    if (!ProgressionState)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_JournalRecords);
+
+    Record.Sequence = ++LastJournalSequence;
+    ApplyRecord(Record);
+
+    if (!Journal.Append(Record))
+    {
+        // Without the journal the change only survives in a snapshot
+        CompactProgression();
+        return;
+    }
+
+    if (Journal.Num() >= CompactAfterRecords && !HasOutstandingWrites())
+    {
+        CompactProgression();
+    }
+}
+
+void UCybersoulsSaveSubsystem::ApplyRecord(const FProgressionRecord& Record)
+{
+    const EQuickHackType QuickHack = static_cast<EQuickHackType>(Record.QuickHack);
+
+    switch (Record.Type)
+    {
+        case EProgressionRecordType::IntegrityXP:
+            ProgressionState->IntegrityXP = FMath::Max(0.0f, ProgressionState->IntegrityXP + Record.Value);
+            break;
+        case EProgressionRecordType::HackingXP:
+            ProgressionState->HackingXP = FMath::Max(0.0f, ProgressionState->HackingXP + Record.Value);
+            break;
+        case EProgressionRecordType::QuickHackUnlocked:
+            ProgressionState->UnlockedQuickHacks.AddUnique(QuickHack);
+            break;
+        case EProgressionRecordType::QuickHackEquipped:
+            if (Record.Slot >= 1)
+            {
+                if (ProgressionState->EquippedQuickHacks.Num() < Record.Slot)
+                {
+                    ProgressionState->EquippedQuickHacks.SetNum(Record.Slot);
+                }
+                ProgressionState->EquippedQuickHacks[Record.Slot - 1] = QuickHack;
+            }
+            break;
+        case EProgressionRecordType::Reset:
+            ProgressionState->IntegrityXP = 0.0f;
+            ProgressionState->HackingXP = 0.0f;
+            break;
+    }
+}
+
+UCybersoulsSaveGame* UCybersoulsSaveSubsystem::LoadSnapshot() const
+{
+    // Read back from the same file the writes go to, not through the platform's slot lookup
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetSnapshotPath(), FILEREAD_Silent))
+    {
+        return nullptr;
+    }
+
+    return Cast<UCybersoulsSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
+}
+
+const FString& UCybersoulsSaveSubsystem::GetSlotName() const
+{
+    return SlotNameOverride.IsEmpty() ? UCybersoulsSaveGame::SaveSlotName : SlotNameOverride;
+}
+
+FString UCybersoulsSaveSubsystem::GetJournalPath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / GetSlotName() + TEXT(".journal");
+}
+
+FString UCybersoulsSaveSubsystem::GetSnapshotPath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / GetSlotName() + TEXT(".sav");
+}
+
+void UCybersoulsSaveSubsystem::StartWrite(UCybersoulsSaveGame* SaveGame)
+{
+    bWriteInFlight = true;
+    InFlightSave = SaveGame;
+
+    // Serialization happens here on the game thread, the disk write on a background task
+    TArray<uint8> Bytes;
+    bool bSerialized = false;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SaveSerialize);
+        bSerialized = UGameplayStatics::SaveGameToMemory(SaveGame, Bytes);
+    }
+
+    if (!bSerialized)
+    {
+        bWriteInFlight = false;
+        InFlightSave = nullptr;
+        bLastWriteSucceeded = false;
+        UE_LOG(LogTemp, Error, TEXT("[XP SAVE] Failed to start saving progression"));
+        return;
+    }
+
+    // Finishing is queued back to the game thread, where FlushAndWait pumps it
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis = TWeakObjectPtr<UCybersoulsSaveSubsystem>(this), Bytes = MoveTemp(Bytes), Path = GetSnapshotPath()]()
+    {
+        const bool bSuccess = FCrashSafeFile::Write(Bytes, Path);
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess]()
+        {
+            if (UCybersoulsSaveSubsystem* SaveSubsystem = WeakThis.Get())
+            {
+                SaveSubsystem->HandleWriteFinished(bSuccess);
+            }
+        });
+    });
+}
+
+void UCybersoulsSaveSubsystem::HandleWriteFinished(bool bSuccess)
+{
+    bWriteInFlight = false;
+    bLastWriteSucceeded = bSuccess;
+
+    UCybersoulsSaveGame* WrittenSave = InFlightSave;
+    InFlightSave = nullptr;
+    HandleSaveWritten(WrittenSave, bSuccess);
+
+    if (bSuccess)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[XP SAVE] Progression written to %s"), *GetSlotName());
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("[XP SAVE] Failed to save progression to disk"));
+    }
+
+    if (UCybersoulsSaveGame* SaveGame = PendingSave)
+    {
+        PendingSave = nullptr;
+        StartWrite(SaveGame);
+    }
+}
+
+void UCybersoulsSaveSubsystem::HandleSaveWritten(UCybersoulsSaveGame* SaveGame, bool bSuccess)
+{
+    // Only reached once the snapshot has been renamed into place, so the records are safe on disk
+    if (bSuccess && SaveGame)
+    {
+        Journal.DiscardThrough(SaveGame->JournalSequence);
+    }
+}
\ No newline at end of file
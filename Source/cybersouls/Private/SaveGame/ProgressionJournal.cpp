@@ -0,0 +1,199 @@
+#include "cybersouls/Public/SaveGame/ProgressionJournal.h"
+#include "cybersouls/Public/SaveGame/CrashSafeFile.h"
+#include "cybersouls/cybersouls.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DECLARE_CYCLE_STAT(TEXT("Journal Append"), STAT_JournalAppend, STATGROUP_Cybersouls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Journal Rewrites"), STAT_JournalRewrites, STATGROUP_Cybersouls);
+
+FProgressionJournal::~FProgressionJournal()
+{
+    Close();
+}
+
+uint32 FProgressionJournal::Open(const FString& InPath, uint32 AfterSequence, TFunctionRef<void(const FProgressionRecord&)> Replay)
+{
+    Close();
+    Path = InPath;
+    Records.Reset();
+
+    uint32 LastSequence = AfterSequence;
+    int32 IntactBytes = 0;
+    bool bHasStaleRecords = false;
+
+    // A crash between deleting the journal and renaming its rewrite leaves only the rewrite
+    FCrashSafeFile::Recover(Path);
+
+    TArray<uint8> Bytes;
+    if (FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+    {
+        for (int32 Offset = 0; Offset + RecordSize <= Bytes.Num(); Offset += RecordSize)
+        {
+            FProgressionRecord Record;
+            // A sequence going backwards is as untrustworthy as a bad CRC
+            if (!Decode(Bytes.GetData() + Offset, Record) || (Record.Sequence > AfterSequence && Record.Sequence <= LastSequence))
+            {
+                break;
+            }
+            IntactBytes = Offset + RecordSize;
+
+            // Written before the snapshot finished, left behind by a crash during compaction
+            if (Record.Sequence <= AfterSequence)
+            {
+                bHasStaleRecords = true;
+                continue;
+            }
+
+            Replay(Record);
+            Records.Add(Record);
+            LastSequence = Record.Sequence;
+        }
+    }
+
+    if (IntactBytes != Bytes.Num())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[XP JOURNAL] Dropped %d bytes of torn records from %s"), Bytes.Num() - IntactBytes, *Path);
+    }
+
+    // New records have to follow intact ones, so anything else is rewritten first
+    if (IntactBytes != Bytes.Num() || bHasStaleRecords)
+    {
+        Rewrite();
+    }
+    else
+    {
+        OpenForAppend(true);
+    }
+
+    return LastSequence;
+}
+
+void FProgressionJournal::Close()
+{
+    Handle.Reset();
+}
+
+bool FProgressionJournal::Append(const FProgressionRecord& Record)
+{
+    SCOPE_CYCLE_COUNTER(STAT_JournalAppend);
+
+    if (!Handle)
+    {
+        return false;
+    }
+
+    uint8 Bytes[RecordSize];
+    Encode(Record, Bytes);
+
+    // Not flushed, the OS owns the bytes once the write returns
+    if (!Handle->Write(Bytes, RecordSize))
+    {
+        // A partial record would hide every later one from replay
+        UE_LOG(LogTemp, Error, TEXT("[XP JOURNAL] Failed to append to %s"), *Path);
+        Rewrite();
+        return false;
+    }
+
+    Records.Add(Record);
+    return true;
+}
+
+void FProgressionJournal::DiscardThrough(uint32 Sequence)
+{
+    int32 NumCovered = 0;
+    while (NumCovered < Records.Num() && Records[NumCovered].Sequence <= Sequence)
+    {
+        ++NumCovered;
+    }
+
+    if (NumCovered == 0)
+    {
+        return;
+    }
+
+    Records.RemoveAt(0, NumCovered);
+
+    // Covered records left in the file are skipped on replay, so there is no need to rewrite it around newer ones
+    if (Records.Num() == 0)
+    {
+        // Nothing left to keep, truncating is enough since the snapshot holds it all
+        Handle.Reset();
+        OpenForAppend(false);
+    }
+}
+
+bool FProgressionJournal::OpenForAppend(bool bAppend)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+    Handle.Reset(PlatformFile.OpenWrite(*Path, bAppend));
+    if (!Handle)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[XP JOURNAL] Failed to open %s, progression will only be saved in snapshots"), *Path);
+        return false;
+    }
+    return true;
+}
+
+bool FProgressionJournal::Rewrite()
+{
+    INC_DWORD_STAT(STAT_JournalRewrites);
+    Handle.Reset();
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(Records.Num() * RecordSize);
+    for (int32 Index = 0; Index < Records.Num(); ++Index)
+    {
+        Encode(Records[Index], Bytes.GetData() + Index * RecordSize);
+    }
+
+    // Open recovers the rewrite if a crash interrupts the swap
+    const bool bWritten = FCrashSafeFile::Write(Bytes, Path);
+    if (!bWritten)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[XP JOURNAL] Failed to rewrite %s"), *Path);
+    }
+
+    return OpenForAppend(true) && bWritten;
+}
+
+void FProgressionJournal::Encode(const FProgressionRecord& Record, uint8* Out)
+{
+    // Sequence | Type | Slot | QuickHack | pad | Value | CRC of the first 12 bytes
+    FMemory::Memcpy(Out, &Record.Sequence, 4);
+    Out[4] = static_cast<uint8>(Record.Type);
+    Out[5] = Record.Slot;
+    Out[6] = Record.QuickHack;
+    Out[7] = 0;
+    FMemory::Memcpy(Out + 8, &Record.Value, 4);
+
+    const uint32 Crc = FCrc::MemCrc32(Out, 12);
+    FMemory::Memcpy(Out + 12, &Crc, 4);
+}
+
+bool FProgressionJournal::Decode(const uint8* In, FProgressionRecord& OutRecord)
+{
+    uint32 StoredCrc = 0;
+    FMemory::Memcpy(&StoredCrc, In + 12, 4);
+    if (StoredCrc != FCrc::MemCrc32(In, 12))
+    {
+        return false;
+    }
+
+    FMemory::Memcpy(&OutRecord.Sequence, In, 4);
+    if (OutRecord.Sequence == 0 || In[4] > static_cast<uint8>(EProgressionRecordType::Reset))
+    {
+        return false;
+    }
+
+    OutRecord.Type = static_cast<EProgressionRecordType>(In[4]);
+    OutRecord.Slot = In[5];
+    OutRecord.QuickHack = In[6];
+    FMemory::Memcpy(&OutRecord.Value, In + 8, 4);
+    return true;
+}
\ No newline at end of file
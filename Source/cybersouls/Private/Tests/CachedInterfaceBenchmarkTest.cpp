@@ -0,0 +1,90 @@
+#include "cybersouls/Private/Tests/CybersoulsTestTargetable.h"
+#include "cybersouls/Public/Interfaces/CachedInterface.h"
+#include "cybersouls/Public/Interfaces/ITargetable.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 NumTargets = 1000;
+    constexpr int32 NumPasses = 100;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCybersoulsCachedInterfaceBenchmark, "Cybersouls.Interfaces.CachedDispatchBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCybersoulsCachedInterfaceBenchmark::RunTest(const FString& Parameters)
+{
+    TArray<UCybersoulsTestTargetable*> Targets;
+    TArray<TCachedInterface<ITargetable>> Handles;
+    Targets.Reserve(NumTargets);
+    Handles.Reserve(NumTargets);
+
+    for (int32 Index = 0; Index < NumTargets; ++Index)
+    {
+        UCybersoulsTestTargetable* Target = NewObject<UCybersoulsTestTargetable>(GetTransientPackage());
+        Target->AddToRoot();
+        Target->bTargetable = Index % 3 != 0;
+        Target->Location = FVector(Index, 0.0f, Index % 2 == 0 ? 0.0f : 200.0f);
+        Targets.Add(Target);
+        Handles.Emplace(Target);
+    }
+
+    TestNotNull(TEXT("Native implementer gets the native path"), Handles[0].GetNative());
+
+    const FVector HitLocation(0.0f, 0.0f, 100.0f);
+
+    // What UpdateTargeting did per actor before the handles: interface check, then two Execute_ calls
+    int32 ExecuteHits = 0;
+    const double ExecuteStart = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+    {
+        for (UCybersoulsTestTargetable* Target : Targets)
+        {
+            if (Target->GetClass()->ImplementsInterface(UTargetable::StaticClass())
+                && ITargetable::Execute_CanBeTargeted(Target)
+                && ITargetable::Execute_GetTargetBodyPart(Target, HitLocation) == EBodyPart::UpperBody)
+            {
+                ++ExecuteHits;
+            }
+        }
+    }
+    const double ExecuteMs = (FPlatformTime::Seconds() - ExecuteStart) * 1000.0;
+
+    // Same calls through handles resolved once
+    int32 CachedHits = 0;
+    const double CachedStart = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+    {
+        for (const TCachedInterface<ITargetable>& Handle : Handles)
+        {
+            if (Handle.Implements()
+                && ITargetable::DispatchCanBeTargeted(Handle)
+                && ITargetable::DispatchGetTargetBodyPart(Handle, HitLocation) == EBodyPart::UpperBody)
+            {
+                ++CachedHits;
+            }
+        }
+    }
+    const double CachedMs = (FPlatformTime::Seconds() - CachedStart) * 1000.0;
+
+    for (UCybersoulsTestTargetable* Target : Targets)
+    {
+        Target->RemoveFromRoot();
+    }
+
+    const int32 NumCalls = NumTargets * NumPasses;
+    AddInfo(FString::Printf(TEXT("Execute_ dispatch: %.3f ms for %d targets (%.1f ns each)"), ExecuteMs, NumCalls, ExecuteMs * 1.0e6 / NumCalls));
+    AddInfo(FString::Printf(TEXT("Cached dispatch: %.3f ms for %d targets (%.1f ns each), %.1fx faster"), CachedMs, NumCalls, CachedMs * 1.0e6 / NumCalls,
+        CachedMs > 0.0 ? ExecuteMs / CachedMs : 0.0));
+
+    TestEqual(TEXT("Both paths give the same answers"), CachedHits, ExecuteHits);
+    TestTrue(TEXT("Cached dispatch is faster than Execute_"), CachedMs < ExecuteMs);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
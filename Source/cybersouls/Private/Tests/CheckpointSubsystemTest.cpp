@@ -0,0 +1,92 @@
+#include "cybersouls/Private/Tests/CybersoulsTestWorld.h"
+#include "cybersouls/Public/SaveGame/CheckpointSubsystem.h"
+#include "cybersouls/Public/SaveGame/CrashSafeFile.h"
+#include "cybersouls/Public/Enemy/CybersoulsBasicEnemy.h"
+#include "cybersouls/Public/Enemy/CybersoulsNetrunner.h"
+#include "cybersouls/Public/Enemy/EnemyPoolSubsystem.h"
+#include "cybersouls/Public/Enemy/EnemyRegistrySubsystem.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 NumEnemies = 200;
+    constexpr int32 NumTimedSaves = 10;
+
+    // Game-thread budget for one checkpoint save
+    constexpr double MaxSaveMs = 5.0;
+
+    const TCHAR* TestCheckpointFileName = TEXT("CybersoulsAutomationCheckpoint.bin");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCybersoulsCheckpointCostTest, "Cybersouls.Checkpoint.SaveAndLoad200Enemies",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCybersoulsCheckpointCostTest::RunTest(const FString& Parameters)
+{
+    FString CheckpointPath;
+    {
+        FCybersoulsTestWorld TestWorld;
+
+        UCheckpointSubsystem* Checkpoints = UCheckpointSubsystem::Get(TestWorld.Get());
+        UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(TestWorld.Get());
+        UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(TestWorld.Get());
+        if (!TestNotNull(TEXT("Checkpoint subsystem"), Checkpoints) || !TestNotNull(TEXT("Enemy pool"), EnemyPool) || !TestNotNull(TEXT("Enemy registry"), Registry))
+        {
+            return false;
+        }
+
+        // Keep the player's checkpoint file out of it
+        Checkpoints->CheckpointFileName = TestCheckpointFileName;
+        CheckpointPath = FPaths::ProjectSavedDir() / TEXT("SaveGames") / TestCheckpointFileName;
+
+        // Half melee, half netrunners, spawned through the pool as waves do
+        for (int32 Index = 0; Index < NumEnemies; ++Index)
+        {
+            const FTransform SpawnTransform(FVector((Index % 20) * 200.0f, (Index / 20) * 200.0f, 100.0f));
+            const TSubclassOf<ACybersoulsEnemyBase> EnemyClass = Index % 2 == 0
+                ? TSubclassOf<ACybersoulsEnemyBase>(ACybersoulsBasicEnemy::StaticClass())
+                : TSubclassOf<ACybersoulsEnemyBase>(ACybersoulsNetrunner::StaticClass());
+            EnemyPool->SpawnEnemy(EnemyClass, SpawnTransform);
+        }
+        TestWorld.Tick(2);
+        TestEqual(TEXT("Every enemy is live"), Registry->GetLiveEnemies().Num(), NumEnemies);
+
+        // First save pays one-off costs such as creating the directory
+        TestTrue(TEXT("Warm-up checkpoint saves"), Checkpoints->SaveCheckpoint());
+
+        double TotalMs = 0.0;
+        double WorstMs = 0.0;
+        for (int32 SaveIndex = 0; SaveIndex < NumTimedSaves; ++SaveIndex)
+        {
+            TestWorld.Tick(1);
+
+            const double StartTime = FPlatformTime::Seconds();
+            Checkpoints->SaveCheckpoint();
+            const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+            TotalMs += ElapsedMs;
+            WorstMs = FMath::Max(WorstMs, ElapsedMs);
+        }
+
+        AddInfo(FString::Printf(TEXT("Checkpoint save with %d enemies: %.3f ms average, %.3f ms worst"), NumEnemies, TotalMs / NumTimedSaves, WorstMs));
+        TestTrue(FString::Printf(TEXT("Worst checkpoint save under %.1f ms"), MaxSaveMs), WorstMs < MaxSaveMs);
+
+        // Loading respawns everyone from the pool in place, no level reload
+        const double LoadStartTime = FPlatformTime::Seconds();
+        TestTrue(TEXT("Checkpoint loads"), Checkpoints->LoadCheckpoint());
+        AddInfo(FString::Printf(TEXT("Checkpoint load with %d enemies: %.3f ms"), NumEnemies, (FPlatformTime::Seconds() - LoadStartTime) * 1000.0));
+        TestEqual(TEXT("Every enemy is back after loading"), Registry->GetLiveEnemies().Num(), NumEnemies);
+    }
+
+    // The world's checkpoint subsystem waited for its writes while it was torn down
+    IFileManager::Get().Delete(*CheckpointPath, false, false, true);
+    IFileManager::Get().Delete(*FCrashSafeFile::GetTempPath(CheckpointPath), false, false, true);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
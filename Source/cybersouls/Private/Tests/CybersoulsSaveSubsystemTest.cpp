@@ -0,0 +1,76 @@
+#include "cybersouls/Public/SaveGame/CybersoulsSaveSubsystem.h"
+#include "cybersouls/Public/SaveGame/CybersoulsSaveGame.h"
+#include "Engine/GameInstance.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 NumTimedSaves = 50;
+
+    // Game-thread budget for queueing one save, serialization included
+    constexpr double MaxAverageSaveMs = 1.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCybersoulsSaveGameThreadCostTest, "Cybersouls.SaveGame.GameThreadCost",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCybersoulsSaveGameThreadCostTest::RunTest(const FString& Parameters)
+{
+    // Subsystems have to live inside a game instance, no world is needed for saving
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+    UCybersoulsSaveSubsystem* SaveSubsystem = NewObject<UCybersoulsSaveSubsystem>(GameInstance);
+    SaveSubsystem->SetSlotNameOverride(TEXT("CybersoulsAutomationSave"));
+
+    UCybersoulsSaveGame* SaveGame = Cast<UCybersoulsSaveGame>(UGameplayStatics::CreateSaveGameObject(UCybersoulsSaveGame::StaticClass()));
+    SaveGame->UnlockedQuickHacks = { EQuickHackType::InterruptProtocol, EQuickHackType::SystemFreeze, EQuickHackType::Firewall, EQuickHackType::Kill,
+        EQuickHackType::CascadeVirus, EQuickHackType::GhostProtocol, EQuickHackType::ChargeDrain, EQuickHackType::GravityFlip };
+    SaveGame->EquippedQuickHacks = { EQuickHackType::Kill, EQuickHackType::CascadeVirus, EQuickHackType::GhostProtocol, EQuickHackType::GravityFlip };
+
+    // First save pays one-off costs such as creating the directory
+    SaveSubsystem->RequestSave(SaveGame);
+    TestTrue(TEXT("Warm-up save reaches the disk"), SaveSubsystem->FlushAndWait());
+
+    double TotalMs = 0.0;
+    double WorstMs = 0.0;
+    for (int32 SaveIndex = 0; SaveIndex < NumTimedSaves; ++SaveIndex)
+    {
+        SaveGame->IntegrityXP = SaveIndex * 10.0f;
+        SaveGame->HackingXP = SaveIndex * 5.0f;
+
+        // Only RequestSave runs on the game thread, waiting for the write is what shutdown does
+        const double StartTime = FPlatformTime::Seconds();
+        SaveSubsystem->RequestSave(SaveGame);
+        const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        TotalMs += ElapsedMs;
+        WorstMs = FMath::Max(WorstMs, ElapsedMs);
+
+        if (!SaveSubsystem->FlushAndWait())
+        {
+            AddError(FString::Printf(TEXT("Save %d did not reach the disk"), SaveIndex));
+            break;
+        }
+    }
+
+    const double AverageMs = TotalMs / NumTimedSaves;
+    AddInfo(FString::Printf(TEXT("Game-thread save cost: %.3f ms average, %.3f ms worst over %d saves"), AverageMs, WorstMs, NumTimedSaves));
+    TestTrue(FString::Printf(TEXT("Average game-thread save cost under %.1f ms"), MaxAverageSaveMs), AverageMs < MaxAverageSaveMs);
+
+    // Loading goes through the same file the background task wrote
+    const UCybersoulsSaveGame* Loaded = SaveSubsystem->LoadSnapshot();
+    if (TestNotNull(TEXT("Snapshot loads back"), Loaded))
+    {
+        TestEqual(TEXT("Loaded Integrity XP matches the last save"), Loaded->IntegrityXP, SaveGame->IntegrityXP);
+        TestEqual(TEXT("Loaded QuickHack unlocks match"), Loaded->UnlockedQuickHacks.Num(), SaveGame->UnlockedQuickHacks.Num());
+    }
+
+    IFileManager::Get().Delete(*SaveSubsystem->GetSnapshotPath(), false, false, true);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "cybersouls/Public/Interfaces/ITargetable.h"
+#include "CybersoulsTestTargetable.generated.h"
+
+/**
+ * Native ITargetable implementer for the interface dispatch automation tests
+ *
+ * Answers from plain fields so the measured cost is the dispatch, not the work.
+ */
+UCLASS(Transient, NotBlueprintable)
+class UCybersoulsTestTargetable : public UObject, public ITargetable
+{
+    GENERATED_BODY()
+
+public:
+    bool bTargetable = true;
+    FVector Location = FVector::ZeroVector;
+
+    virtual bool CanBeTargeted_Implementation() const override { return bTargetable; }
+
+    virtual EBodyPart GetTargetBodyPart_Implementation(const FVector& HitLocation) const override
+    {
+        return HitLocation.Z > Location.Z ? EBodyPart::UpperBody : EBodyPart::LeftLeg;
+    }
+
+    virtual FVector GetTargetLocation_Implementation() const override { return Location; }
+
+    virtual bool IsValidTargetForAbility_Implementation(TSubclassOf<UObject> AbilityClass) const override { return bTargetable; }
+};
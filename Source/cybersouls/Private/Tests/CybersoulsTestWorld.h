@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Empty game world that lives for one automation test
+ *
+ * Play has begun, so world subsystems exist and spawned actors run BeginPlay
+ * and get their AI controllers as they would in a level. Destroyed again when
+ * it goes out of scope.
+ */
+class FCybersoulsTestWorld
+{
+public:
+    FCybersoulsTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false);
+
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+    }
+
+    ~FCybersoulsTestWorld()
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    FCybersoulsTestWorld(const FCybersoulsTestWorld&) = delete;
+    FCybersoulsTestWorld& operator=(const FCybersoulsTestWorld&) = delete;
+
+    UWorld* Get() const { return World; }
+
+    template<typename T>
+    T* Spawn(const FVector& Location)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        return World->SpawnActor<T>(T::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+    }
+
+    /** Spawn Count actors in rows of 20, Spacing apart */
+    template<typename T>
+    TArray<T*> SpawnGrid(int32 Count, float Spacing = 200.0f)
+    {
+        TArray<T*> Spawned;
+        Spawned.Reserve(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            if (T* Actor = Spawn<T>(FVector((Index % 20) * Spacing, (Index / 20) * Spacing, 100.0f)))
+            {
+                Spawned.Add(Actor);
+            }
+        }
+        return Spawned;
+    }
+
+    /** Advance the world, timers and tickable subsystems included */
+    void Tick(int32 NumFrames, float DeltaTime = 1.0f / 60.0f)
+    {
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            World->Tick(LEVELTICK_All, DeltaTime);
+        }
+    }
+
+private:
+    UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
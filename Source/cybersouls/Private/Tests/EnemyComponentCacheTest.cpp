@@ -0,0 +1,57 @@
+#include "cybersouls/Private/Tests/CybersoulsTestWorld.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/CybersoulsBasicEnemy.h"
+#include "cybersouls/Public/Enemy/CybersoulsNetrunner.h"
+#include "cybersouls/Public/Attributes/EnemyAttributeComponent.h"
+#include "cybersouls/Public/Abilities/AttackAbilityComponent.h"
+#include "cybersouls/Public/Abilities/HackAbilityComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 NumEnemiesPerType = 25;
+    constexpr int32 NumFrames = 120;
+
+    // Anything resolved per frame would show up as at least one lookup per enemy per frame
+    constexpr double MaxLookupsPerFrame = 1.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCybersoulsEnemyComponentCacheTest, "Cybersouls.Enemy.ComponentLookupsPerFrame",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCybersoulsEnemyComponentCacheTest::RunTest(const FString& Parameters)
+{
+    FCybersoulsTestWorld TestWorld;
+
+    const int32 LookupsBeforeSpawn = ACybersoulsEnemyBase::GetNumComponentLookups();
+
+    TArray<ACybersoulsEnemyBase*> Enemies;
+    Enemies.Append(TestWorld.SpawnGrid<ACybersoulsBasicEnemy>(NumEnemiesPerType));
+    Enemies.Append(TestWorld.SpawnGrid<ACybersoulsNetrunner>(NumEnemiesPerType, 210.0f));
+    TestEqual(TEXT("Every enemy spawned"), Enemies.Num(), NumEnemiesPerType * 2);
+
+    const int32 LookupsAfterSpawn = ACybersoulsEnemyBase::GetNumComponentLookups();
+    AddInfo(FString::Printf(TEXT("%d component lookups while spawning %d enemies"), LookupsAfterSpawn - LookupsBeforeSpawn, Enemies.Num()));
+
+    // The cached getters must hand out the components a lookup would have found
+    for (ACybersoulsEnemyBase* Enemy : Enemies)
+    {
+        TestTrue(TEXT("Cached attributes match"), Enemy->GetEnemyAttributes() == Enemy->FindComponentByClass<UEnemyAttributeComponent>());
+        TestTrue(TEXT("Cached attack ability matches"), Enemy->GetAttackAbility() == Enemy->FindComponentByClass<UAttackAbilityComponent>());
+        TestTrue(TEXT("Cached hack ability matches"), Enemy->GetHackAbility() == Enemy->FindComponentByClass<UHackAbilityComponent>());
+    }
+
+    // AI thinking, ability ticks and timers all run here
+    TestWorld.Tick(NumFrames);
+
+    const int32 LookupsWhileRunning = ACybersoulsEnemyBase::GetNumComponentLookups() - LookupsAfterSpawn;
+    const double LookupsPerFrame = static_cast<double>(LookupsWhileRunning) / NumFrames;
+    AddInfo(FString::Printf(TEXT("%d component lookups over %d frames, %.2f per frame"), LookupsWhileRunning, NumFrames, LookupsPerFrame));
+    TestTrue(FString::Printf(TEXT("Fewer than %.0f component lookups per frame"), MaxLookupsPerFrame), LookupsPerFrame < MaxLookupsPerFrame);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,84 @@
+#include "cybersouls/Private/Tests/CybersoulsTestWorld.h"
+#include "cybersouls/Public/Combat/TargetLockComponent.h"
+#include "cybersouls/Public/Enemy/CybersoulsBasicEnemy.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 NumEnemies = 200;
+    constexpr int32 NumSwitches = 100;
+
+    // Input-to-switch budget with every enemy in the lock cone
+    constexpr double MaxSwitchLatencyMs = 1.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCybersoulsTargetLockSwitchTest, "Cybersouls.TargetLock.SwitchLatency",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCybersoulsTargetLockSwitchTest::RunTest(const FString& Parameters)
+{
+    FCybersoulsTestWorld TestWorld;
+
+    // Enemies stand in rows in front of the player, frozen so the cone keeps all of them
+    TArray<ACybersoulsBasicEnemy*> Enemies = TestWorld.SpawnGrid<ACybersoulsBasicEnemy>(NumEnemies);
+    for (ACybersoulsBasicEnemy* Enemy : Enemies)
+    {
+        Enemy->GetCharacterMovement()->DisableMovement();
+    }
+    TestEqual(TEXT("Every enemy spawned"), Enemies.Num(), NumEnemies);
+
+    APawn* Player = TestWorld.Spawn<APawn>(FVector(-500.0f, 900.0f, 100.0f));
+    UTargetLockComponent* TargetLock = NewObject<UTargetLockComponent>(Player);
+    TargetLock->EnemyClass = ACybersoulsEnemyBase::StaticClass();
+    TargetLock->MaxLockDistance = 10000.0f;
+    TargetLock->RegisterComponent();
+
+    // Let the registry grid and the batched line-of-sight results catch up
+    TestWorld.Tick(5);
+
+    TargetLock->ToggleTargetLock();
+    if (!TestTrue(TEXT("Locked onto an enemy"), TargetLock->IsLocked()))
+    {
+        return false;
+    }
+    TestWorld.Tick(5);
+
+    double TotalMs = 0.0;
+    double WorstMs = 0.0;
+    int32 NumChanged = 0;
+    for (int32 SwitchIndex = 0; SwitchIndex < NumSwitches; ++SwitchIndex)
+    {
+        const AActor* PreviousTarget = TargetLock->GetCurrentTarget();
+
+        // One switch per frame, so some of them land on a frame whose candidate set is due a refresh
+        const double StartTime = FPlatformTime::Seconds();
+        if (SwitchIndex % 2 == 0)
+        {
+            TargetLock->ChangeTargetRight();
+        }
+        else
+        {
+            TargetLock->ChangeTargetLeft();
+        }
+        const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        TotalMs += ElapsedMs;
+        WorstMs = FMath::Max(WorstMs, ElapsedMs);
+        NumChanged += TargetLock->GetCurrentTarget() != PreviousTarget ? 1 : 0;
+
+        TestWorld.Tick(1);
+    }
+
+    AddInfo(FString::Printf(TEXT("Target switch latency with %d enemies: %.4f ms average, %.4f ms worst"), NumEnemies, TotalMs / NumSwitches, WorstMs));
+    TestEqual(TEXT("Every switch moved the lock"), NumChanged, NumSwitches);
+    TestTrue(FString::Printf(TEXT("Worst switch under %.1f ms"), MaxSwitchLatencyMs), WorstMs < MaxSwitchLatencyMs);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
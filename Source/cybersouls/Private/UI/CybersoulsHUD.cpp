@@ -292,7 +292,7 @@ void ACybersoulsHUD::DrawTargetInfo()
 	// Enemy charges (if applicable)
 	if (Enemy->EnemyType == EEnemyType::Block)
 	{
-		UBlockAbilityComponent* BlockAbility = Enemy->FindComponentByClass<UBlockAbilityComponent>();
+		UBlockAbilityComponent* BlockAbility = Enemy->GetBlockAbility();
 		if (BlockAbility)
 		{
 			FString BlockText = FString::Printf(TEXT("Block Charges: %d"), BlockAbility->CurrentBlockCharges);
@@ -301,7 +301,7 @@ void ACybersoulsHUD::DrawTargetInfo()
 	}
 		else if (Enemy->EnemyType == EEnemyType::Dodge)
 		{
-			UDodgeAbilityComponent* DodgeAbility = Enemy->FindComponentByClass<UDodgeAbilityComponent>();
+			UDodgeAbilityComponent* DodgeAbility = Enemy->GetDodgeAbility();
 			if (DodgeAbility)
 			{
 				FString DodgeText = FString::Printf(TEXT("Dodge Charges: %d"), DodgeAbility->CurrentDodgeCharges);
@@ -1116,6 +1116,16 @@ void ACybersoulsHUD::DrawCanvasInventory()
 	DrawPassiveDropdown(PanelX, PanelWidth);
 }
 
+void ACybersoulsHUD::ResetForLevelRestart()
+{
+	bShowXPDisplay = false;
+	bShowDeathScreen = false;
+	bShowPlayAgainButton = false;
+	
+	// Also restores the gameplay input mode
+	ForceCloseInventory();
+}
+
 void ACybersoulsHUD::ForceCloseInventory()
 {
 	APlayerController* PC = GetOwningPlayerController();
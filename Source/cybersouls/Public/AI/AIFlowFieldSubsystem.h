@@ -0,0 +1,98 @@
+// AIFlowFieldSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIFlowFieldSubsystem.generated.h"
+
+/**
+ * Shared flow field toward the player for melee swarms
+ *
+ * Keeps one square grid of cells centred on the chase target. Cell walkability is
+ * probed against the navmesh once per world cell and height band and cached, so
+ * stacked floors, bridges and ramps each get their own answer. The integration
+ * field is rebuilt in full, but only when the target enters a new cell or band;
+ * a pass over the default 64x64 grid is cheap next to the probes it reuses.
+ * Chasers sample the field for a nearby waypoint and move there directly, so
+ * pathing cost depends on the grid size rather than on how many enemies are chasing.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UAIFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no flow field */
+	static UAIFlowFieldSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	bool IsFlowFieldEnabled() const { return bFlowFieldEnabled; }
+
+	/**
+	 * Get a waypoint a few cells down the field from Location toward Target
+	 *
+	 * Also makes Target the field's goal from the next tick on.
+	 *
+	 * @param Location Where the chaser is
+	 * @param Target The actor being chased
+	 * @param OutWaypoint Point to move straight to, at the chaser's height
+	 * @return False if the field cannot guide this chaser (disabled, not built
+	 *         yet, outside the grid, unreachable or already close to the target)
+	 */
+	bool GetFlowWaypoint(const FVector& Location, AActor* Target, FVector& OutWaypoint);
+
+	// Off by default; physical enemies use regular pathfinding unless enabled
+	UPROPERTY(Config)
+	bool bFlowFieldEnabled = false;
+
+	// Edge length of one cell, in Unreal units
+	UPROPERTY(Config)
+	float CellSize = 100.0f;
+
+	// Cells along each side of the grid
+	UPROPERTY(Config)
+	int32 GridDimension = 64;
+
+	// How many cells ahead the returned waypoint lies
+	UPROPERTY(Config)
+	int32 LookaheadCells = 3;
+
+	// Chasers this many cells or fewer from the target fall back to MoveTo
+	UPROPERTY(Config)
+	int32 MinFlowDistanceCells = 3;
+
+	// Vertical half-height used when probing cells against the navmesh, also the height of one cached band
+	UPROPERTY(Config)
+	float ProbeVerticalExtent = 300.0f;
+
+private:
+	TWeakObjectPtr<AActor> FieldTarget;
+
+	// World cell and height band the target stood in at the last rebuild
+	FIntPoint TargetCell = FIntPoint(MAX_int32, MAX_int32);
+	int32 TargetHeightBand = MAX_int32;
+
+	// World cell at grid index (0, 0)
+	FIntPoint GridOrigin = FIntPoint::ZeroValue;
+
+	bool bFieldValid = false;
+
+	// Per grid cell, row major
+	TArray<int32> IntegrationCosts;
+	TArray<int8> FlowDirections;
+
+	// World cell and height band -> walkable for the target's current band, dropped when the band or navmesh changes or it grows past a few grids
+	TMap<FIntVector, bool> WalkableCells;
+
+	FIntPoint GetWorldCell(const FVector& Location) const;
+	int32 GetHeightBand(float Z) const;
+	bool IsWalkable(const FIntPoint& WorldCell, int32 HeightBand);
+	void RebuildField(const FVector& TargetLocation);
+
+	UFUNCTION()
+	void OnNavigationGenerated(class ANavigationData* NavData);
+};
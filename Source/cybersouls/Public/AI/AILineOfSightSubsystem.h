@@ -0,0 +1,81 @@
+// AILineOfSightSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "AILineOfSightSubsystem.generated.h"
+
+/**
+ * Batched line-of-sight service for enemy perception
+ *
+ * Controllers ask for LOS between a viewer and a target every think. Requests made
+ * during a frame are deduplicated per viewer/target pair and submitted together as
+ * async traces when the subsystem ticks; callers are answered from the most recent
+ * completed result as long as it is younger than their staleness limit. Only a
+ * pair with no usable result pays for a synchronous trace.
+ */
+UCLASS()
+class CYBERSOULS_API UAILineOfSightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no LOS service */
+	static UAILineOfSightSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Check line of sight from Viewer to Target
+	 *
+	 * Queues an async trace for this frame's batch and returns the cached result if
+	 * it is no older than MaxResultAge, otherwise traces synchronously.
+	 *
+	 * @param Viewer Actor doing the looking, ignored by the trace
+	 * @param Target Actor being looked at, ignored by the trace
+	 * @param Start Trace start, usually the viewer's eye position
+	 * @param End Trace end, usually the target location
+	 * @param MaxResultAge Oldest cached result, in seconds, the caller will accept
+	 * @return True if nothing blocks ECC_Visibility between Start and End
+	 */
+	bool HasLineOfSight(const AActor* Viewer, const AActor* Target, const FVector& Start, const FVector& End, float MaxResultAge);
+
+	/** Number of traces submitted in the last batch */
+	int32 GetLastBatchSize() const { return LastBatchSize; }
+
+private:
+	typedef TPair<TWeakObjectPtr<const AActor>, TWeakObjectPtr<const AActor>> FLineOfSightKey;
+
+	struct FLineOfSightResult
+	{
+		bool bHasLineOfSight = false;
+		double CompletedTime = 0.0;
+		double LastRequestedTime = 0.0;
+	};
+
+	struct FPendingTrace
+	{
+		FVector Start;
+		FVector End;
+	};
+
+	TMap<FLineOfSightKey, FLineOfSightResult> Results;
+	TMap<FLineOfSightKey, FPendingTrace> PendingTraces;
+	TMap<uint32, FLineOfSightKey> InFlightTraces;
+
+	FTraceDelegate TraceDelegate;
+	uint32 NextTraceId = 0;
+	int32 LastBatchSize = 0;
+
+	// Results nobody has asked for in this long are dropped
+	static constexpr double UnusedResultLifetime = 2.0;
+
+	void SubmitPendingTraces();
+	void PruneResults(double Now);
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+	bool TraceNow(const AActor* Viewer, const AActor* Target, const FVector& Start, const FVector& End) const;
+	static FCollisionQueryParams MakeQueryParams(const AActor* Viewer, const AActor* Target);
+};
@@ -0,0 +1,92 @@
+// AISquadKnowledgeSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AISquadKnowledgeSubsystem.generated.h"
+
+/** What a squad currently knows about the player */
+USTRUCT()
+struct FSquadPlayerKnowledge
+{
+	GENERATED_BODY()
+
+	TWeakObjectPtr<AActor> Player;
+
+	FVector LastKnownLocation = FVector::ZeroVector;
+
+	// Where the enemy that reported this was standing
+	FVector SpotterLocation = FVector::ZeroVector;
+
+	// World time of the report, negative if nothing has been reported
+	double Timestamp = -1.0;
+
+	// Enemies in the area currently reporting sight of the player
+	int32 SpotterCount = 0;
+};
+
+/**
+ * Shared player knowledge for groups of enemies
+ *
+ * Enemies that can see the player write a sighting once per think into the area
+ * they stand in; every other enemy reads the freshest sighting within its alert
+ * radius when it thinks. Areas are a coarse XY grid, so a read touches a handful
+ * of entries no matter how many enemies are spotting.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UAISquadKnowledgeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no squad knowledge */
+	static UAISquadKnowledgeSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Record that Spotter can currently see Player
+	 *
+	 * @param Spotter The enemy pawn reporting the sighting
+	 * @param Player The player actor that was seen
+	 * @param PlayerLocation Where the player was seen
+	 */
+	void ReportPlayerSighting(const AActor* Spotter, AActor* Player, const FVector& PlayerLocation);
+
+	/** Spotter has lost sight of the player and stops counting as a spotter */
+	void ClearSpotter(const AActor* Spotter);
+
+	/**
+	 * Find the freshest sighting reported by a spotter within Radius of Location
+	 *
+	 * @param Location Position of the enemy asking
+	 * @param Radius How far away the spotter may be
+	 * @param MaxAge Oldest sighting to accept, in seconds
+	 * @param OutKnowledge Filled in when a sighting is found
+	 * @return True if a sighting was found
+	 */
+	bool GetPlayerKnowledge(const FVector& Location, float Radius, float MaxAge, FSquadPlayerKnowledge& OutKnowledge) const;
+
+	// Edge length of one knowledge area, in Unreal units
+	UPROPERTY(Config)
+	float AreaSize = 2000.0f;
+
+	// Spotters that have not reported for this long stop counting, in seconds
+	UPROPERTY(Config)
+	float SpotterTimeout = 1.0f;
+
+private:
+	struct FSquadArea
+	{
+		FSquadPlayerKnowledge Knowledge;
+		TMap<TWeakObjectPtr<const AActor>, double> SpotterReportTimes;
+	};
+
+	// Only areas with at least one spotter, see RemoveSpotterFromArea
+	TMap<FIntPoint, FSquadArea> Areas;
+	TMap<TWeakObjectPtr<const AActor>, FIntPoint> SpotterAreas;
+
+	FIntPoint GetArea(const FVector& Location) const;
+	void RemoveSpotterFromArea(const AActor* Spotter, const FIntPoint& Area);
+	void RefreshSpotterCount(FSquadArea& Area, double Now) const;
+};
@@ -0,0 +1,130 @@
+// AIThinkSchedulerSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "cybersouls/Public/AI/BaseEnemyAIController.h"
+#include "AIThinkSchedulerSubsystem.generated.h"
+
+/** One registered enemy brain and when it last thought */
+USTRUCT()
+struct FScheduledThinker
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	ABaseEnemyAIController* Controller = nullptr;
+
+	double LastThinkTime = 0.0;
+
+	double NextTierEvaluationTime = 0.0;
+
+	float ThinkInterval = 0.1f;
+};
+
+/**
+ * Central scheduler for enemy AI think updates
+ *
+ * Controllers register on possess instead of thinking in their own Tick. Each frame
+ * the scheduler walks the thinkers round-robin from where it stopped last frame and
+ * runs every one that is due, until the frame budget is spent. Anything still due
+ * is deferred to the next frame, so big fights stretch think latency rather than
+ * frame time.
+ *
+ * Every thinker also gets an EAILODTier that sets how often it is due: Combat for
+ * engaged or on-screen enemies close to the player, Alerted for anything engaged,
+ * visible or within AlertedDistance, and Dormant for the rest.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UAIThinkSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no scheduler */
+	static UAIThinkSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterThinker(ABaseEnemyAIController* Controller);
+	void UnregisterThinker(ABaseEnemyAIController* Controller);
+
+	/** Thinks that were due but did not fit in the last frame's budget */
+	int32 GetDeferredThinkCount() const { return LastDeferredCount; }
+
+	/** Thinks that ran last frame */
+	int32 GetExecutedThinkCount() const { return LastExecutedCount; }
+
+	/**
+	 * Claim one of this frame's path queries
+	 * 
+	 * @return False once MaxPathRequestsPerFrame have been issued this frame;
+	 *         the caller should keep its current path and retry next think
+	 */
+	bool TryConsumePathRequest();
+
+	// Time between thinks for a single controller in each tier, in seconds
+	UPROPERTY(Config)
+	float CombatThinkInterval = 0.1f;
+
+	UPROPERTY(Config)
+	float AlertedThinkInterval = 0.25f;
+
+	UPROPERTY(Config)
+	float DormantThinkInterval = 1.0f;
+
+	// Movement component tick interval per tier, 0 means every frame
+	UPROPERTY(Config)
+	float CombatMovementTickInterval = 0.0f;
+
+	UPROPERTY(Config)
+	float AlertedMovementTickInterval = 0.033f;
+
+	UPROPERTY(Config)
+	float DormantMovementTickInterval = 0.25f;
+
+	// Max distance to the player for the Combat tier
+	UPROPERTY(Config)
+	float CombatDistance = 2500.0f;
+
+	// Max distance to the player for the Alerted tier when not engaged or on screen
+	UPROPERTY(Config)
+	float AlertedDistance = 5000.0f;
+
+	// How long since last render still counts as on screen, in seconds
+	UPROPERTY(Config)
+	float OnScreenTolerance = 0.25f;
+
+	// How often each thinker's tier is re-evaluated, in seconds
+	UPROPERTY(Config)
+	float TierEvaluationInterval = 0.5f;
+
+	// Path queries all enemies together may issue per frame
+	UPROPERTY(Config)
+	int32 MaxPathRequestsPerFrame = 8;
+
+	// Game-thread time all thinks together may use per frame, in milliseconds
+	UPROPERTY(Config)
+	float FrameBudgetMs = 2.0f;
+
+private:
+	UPROPERTY()
+	TArray<FScheduledThinker> Thinkers;
+
+	int32 Cursor = 0;
+	bool bHasRemovedThinkers = false;
+
+	int32 LastDeferredCount = 0;
+	int32 LastExecutedCount = 0;
+
+	uint64 PathBudgetFrame = 0;
+	int32 PathRequestsThisFrame = 0;
+
+	void CompactThinkers();
+	void UpdateTier(FScheduledThinker& Thinker, double Now);
+	EAILODTier EvaluateTier(const ABaseEnemyAIController* Controller) const;
+	float GetThinkInterval(EAILODTier Tier) const;
+	float GetMovementTickInterval(EAILODTier Tier) const;
+};
@@ -4,6 +4,38 @@
 #include "AIController.h"
 #include "BaseEnemyAIController.generated.h"
 
+/**
+ * How much attention an enemy currently deserves
+ * 
+ * Assigned by UAIThinkSchedulerSubsystem from distance to the player,
+ * on-screen status and alert state. Lower tiers think less often, skip
+ * perception traces and update their movement less frequently.
+ */
+UENUM(BlueprintType)
+enum class EAILODTier : uint8
+{
+	Combat UMETA(DisplayName = "Combat"),
+	Alerted UMETA(DisplayName = "Alerted"),
+	Dormant UMETA(DisplayName = "Dormant")
+};
+
+/**
+ * What an AI currently believes about the player
+ * 
+ * Driven once per think by ABaseEnemyAIController::UpdatePerception.
+ * Sight has to be held for SightAcquireTime before a suspicious AI
+ * engages, and lost for SightLossGraceTime before an engaged AI starts
+ * searching, so a single flickering trace cannot bounce the state.
+ */
+UENUM(BlueprintType)
+enum class EAIPerceptionState : uint8
+{
+	Unaware UMETA(DisplayName = "Unaware"),
+	Suspicious UMETA(DisplayName = "Suspicious"),
+	Engaged UMETA(DisplayName = "Engaged"),
+	Searching UMETA(DisplayName = "Searching")
+};
+
 /**
  * Base AI controller for all enemy types in Cybersouls
  * 
@@ -20,29 +52,94 @@ public:
 	ABaseEnemyAIController();
 
 	/**
-	 * Update player target reference when character switches
+	 * Update player target reference from the current player pawn
 	 * 
-	 * Called when the player switches between characters to ensure
-	 * AI controllers track the correct player pawn.
+	 * Called on possession. Character switches arrive through
+	 * HandlePlayerCharacterSwitched instead.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "AI")
 	void UpdatePlayerTarget();
 
+	/**
+	 * Run one AI decision update
+	 * 
+	 * Called by UAIThinkSchedulerSubsystem while possessing a pawn, in place
+	 * of doing the work in Tick, so thinks can be spread under a frame budget.
+	 * 
+	 * @param DeltaTime Seconds since this controller last thought
+	 */
+	virtual void Think(float DeltaTime);
+
+	/**
+	 * Apply a new LOD tier
+	 * 
+	 * @param NewTier Tier chosen by the scheduler
+	 * @param TickInterval Controller tick interval for this tier
+	 * @param MovementTickInterval Pawn movement component tick interval for this tier
+	 */
+	void SetLODTier(EAILODTier NewTier, float TickInterval, float MovementTickInterval);
+
+	EAILODTier GetLODTier() const { return LODTier; }
+
+	/** True while this AI is tracking, searching for or has been alerted to the player */
+	virtual bool IsEngaged() const { return PerceptionState != EAIPerceptionState::Unaware || bIsAlertingAllies; }
+
+	AActor* GetPlayerTarget() const { return PlayerTarget; }
+
+	EAIPerceptionState GetPerceptionState() const { return PerceptionState; }
+
+	/** Whether the player was in sight on the last perception update */
+	bool IsPlayerVisible() const { return bPlayerVisible; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void OnUnPossess() override;
 
 	/**
 	 * Check if this AI can see the specified target
 	 * 
-	 * Performs a line trace from the AI's eye position to the target.
+	 * Asks UAILineOfSightSubsystem for LOS from the AI's eye position to the
+	 * target. The answer may be up to MaxLineOfSightAge seconds old.
 	 * 
 	 * @param Target The actor to check visibility for
 	 * @return True if there's a clear line of sight to the target
 	 */
 	virtual bool CanSeeTarget(AActor* Target) const;
 	
+	/**
+	 * Sample sight of the player and advance the perception state machine
+	 * 
+	 * Called from Think before squad knowledge is exchanged. Fires
+	 * OnPerceptionStateChanged only when the state actually changes.
+	 */
+	void UpdatePerception();
+	
+	/**
+	 * Move to a new perception state
+	 * 
+	 * Does nothing if the AI is already in NewState.
+	 * 
+	 * @param NewState State to enter
+	 */
+	void SetPerceptionState(EAIPerceptionState NewState);
+	
+	/**
+	 * Called once per perception state change
+	 * 
+	 * The base implementation calls HandlePlayerVisibility when entering
+	 * Engaged and HandlePlayerLostVisibility when leaving it. Override to
+	 * start or stop state specific behavior, and call Super.
+	 * 
+	 * @param OldState State that was left
+	 * @param NewState State that was entered
+	 */
+	virtual void OnPerceptionStateChanged(EAIPerceptionState OldState, EAIPerceptionState NewState);
+	
+	/** Seconds spent in the current perception state */
+	float GetTimeInPerceptionState() const;
+	
 	/**
 	 * Calculate distance to a target actor
 	 * 
@@ -54,30 +151,36 @@ protected:
 	/**
 	 * Alert nearby enemies about a detected target
 	 * 
-	 * Starts continuous location updates to allies within AlertRadius.
+	 * Writes the sighting to UAISquadKnowledgeSubsystem and keeps refreshing
+	 * it every think until StopAlertingAllies.
 	 * 
 	 * @param Target The detected target (usually the player)
 	 */
 	void AlertNearbyEnemies(AActor* Target);
 	
 	/**
-	 * Send player location update to all nearby allies
+	 * Exchange player knowledge with nearby allies
 	 * 
-	 * Called periodically while tracking a target to keep allies informed.
+	 * Spotters refresh their sighting; everyone else reads the freshest
+	 * sighting within AlertRadius and forwards it to ReceiveAlert or
+	 * ReceivePlayerLocationUpdate depending on the perception state.
 	 */
-	void UpdateAlliesWithPlayerLocation();
+	void SyncSquadKnowledge();
 	
 	/**
 	 * Stop sending alerts to allies
 	 * 
-	 * Clears the alert timer and resets alert state.
+	 * Withdraws this AI as a spotter and resets alert state.
 	 */
 	void StopAlertingAllies();
 	
 	/**
 	 * Handle receiving an alert from another enemy
 	 * 
-	 * Override in derived classes to implement alert response behavior.
+	 * Called when an ally's sighting reaches this AI while it is unaware
+	 * of or only suspicious about the player. Later sightings arrive through
+	 * ReceivePlayerLocationUpdate. Override in derived classes to implement
+	 * alert response behavior.
 	 * 
 	 * @param AlertTarget The target that was spotted
 	 * @param InAlertLocation Last known location of the target
@@ -95,14 +198,14 @@ protected:
 	virtual void ReceivePlayerLocationUpdate(AActor* Player, const FVector& PlayerLocation) {}
 	
 	/**
-	 * Called when this AI gains sight of the player
+	 * Called when this AI engages the player
 	 * 
 	 * Override to implement visibility gained behavior.
 	 */
 	virtual void HandlePlayerVisibility() {}
 	
 	/**
-	 * Called when this AI loses sight of the player
+	 * Called when this AI stops engaging the player
 	 * 
 	 * Override to implement visibility lost behavior.
 	 */
@@ -115,22 +218,66 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Perception")
 	float EyeHeight = 80.0f;
 
+	// Oldest batched line-of-sight result this AI will act on, in seconds
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Perception")
+	float MaxLineOfSightAge = 0.3f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Communication")
 	float AlertRadius = 2000.0f;
 
+	// Oldest ally sighting this AI will act on, in seconds
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Communication")
-	float AlertUpdateInterval = 1.0f;
+	float SquadKnowledgeMaxAge = 1.0f;
+
+	// Continuous sight needed before a suspicious AI engages, in seconds
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Perception")
+	float SightAcquireTime = 0.2f;
+
+	// How long an engaged AI keeps engaging after losing sight, in seconds
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Perception")
+	float SightLossGraceTime = 0.5f;
+
+	// How long a suspicious AI waits for another sighting before calming down, in seconds
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Perception")
+	float SuspicionTimeout = 3.0f;
+
+	// How long a searching AI looks for the player before giving up, in seconds
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Perception")
+	float SearchDuration = 5.0f;
+
+	// Perception state
+	EAIPerceptionState PerceptionState = EAIPerceptionState::Unaware;
+	double PerceptionStateEnterTime = 0.0;
+	double PlayerVisibleSinceTime = -1.0;
+	double LastPlayerSeenTime = -1.0;
+	bool bPlayerVisible = false;
+	FVector LastKnownPlayerLocation = FVector::ZeroVector;
 
 	// Alert system
-	FTimerHandle AlertUpdateTimerHandle;
 	bool bIsAlertingAllies = false;
+	double LastSquadKnowledgeTime = -1.0;
 	AActor* CurrentTarget = nullptr;
 
 	// Common member variables
 	class ACybersoulsEnemyBase* ControlledEnemy = nullptr;
 	AActor* PlayerTarget = nullptr;
 
+	// Current level of detail, dormant AIs skip perception entirely
+	EAILODTier LODTier = EAILODTier::Combat;
+
 	// Debug settings
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Debug")
 	bool bDebugDrawSightLine = false;
+
+private:
+	/** Listen for character switches on the player controller, once for this controller's lifetime */
+	void SubscribeToCharacterSwitches();
+
+	void HandlePlayerCharacterSwitched(APawn* NewCharacter);
+
+	// Only the default character is chased, CyberState is ignored
+	void SetPlayerTargetFromCharacter(AActor* PlayerCharacter);
+
+	TWeakObjectPtr<class ACyberSoulsPlayerController> CharacterSwitchSource;
+	FDelegateHandle CharacterSwitchedHandle;
 };
\ No newline at end of file
@@ -22,11 +22,12 @@ class CYBERSOULS_API AHackingEnemyAIController : public ABaseEnemyAIController
 public:
 	AHackingEnemyAIController();
 
+	virtual void Think(float DeltaTime) override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void OnUnPossess() override;
-	virtual void Tick(float DeltaTime) override;
 	
 	// Override visibility handling from base class
 	virtual void HandlePlayerVisibility() override;
@@ -58,6 +59,9 @@ private:
 	UPROPERTY()
 	class UQuickHackComponent* InterruptProtocolComponent = nullptr;
 	
+	// Set once the references above come from the enemy's cached QuickHacks, which fill in at its BeginPlay
+	bool bQuickHackComponentsCached = false;
+	
 	void UpdateHackingBehavior();
 	void PerformHacking();
 	void AttemptQuickHack();
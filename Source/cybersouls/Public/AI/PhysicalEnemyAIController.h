@@ -14,11 +14,12 @@ public:
 	APhysicalEnemyAIController();
 	virtual ~APhysicalEnemyAIController();
 
+	virtual void Think(float DeltaTime) override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void OnUnPossess() override;
-	virtual void Tick(float DeltaTime) override;
 
 private:
 	// Close combat behavior parameters
@@ -28,27 +29,24 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "AI")
 	float AcceptanceRadius = 50.0f;
 	
-	// Attack timing
-	FTimerHandle AttackTimerHandle;
-	
-	// Search behavior
-	FVector LastKnownPlayerLocation;
-	bool bIsSearching = false;
-	float SearchTimeRemaining = 0.0f;
-	const float MaxSearchTime = 5.0f; // Search for 5 seconds before giving up
+	// A location move is only replanned once its goal drifts further than this
+	UPROPERTY(EditDefaultsOnly, Category = "AI")
+	float ReplanDistanceThreshold = 150.0f;
 	
-	// Tracking state
-	bool bHasSeenPlayer = false;
-	float LastSeenTime = 0.0f;
-	const float SearchTime = 5.0f;
+	// Current path, reused until the goal drifts or the path is lost
+	FAIMoveRequest BaseMoveRequest;
+	AActor* MoveGoalActor = nullptr;
+	FVector MoveGoalLocation = FVector::ZeroVector;
 	
-	// Alert handling
-	bool bIsAlerted = false; // Whether this enemy has been alerted by another
-	FVector AlertLocation; // Location to investigate when alerted
+	// Attack timing
+	FTimerHandle AttackTimerHandle;
 	
-	void UpdateCombatBehavior();
+	void UpdateCombatBehavior(float DeltaTime);
 	void MoveToTarget();
 	void MoveToLocation(const FVector& Location);
+	bool MoveAlongFlowField();
+	bool IsFollowingPath() const;
+	bool IssueMoveRequest(const FAIMoveRequest& MoveRequest);
 	void PerformAttack();
 	bool IsInAttackRange() const;
 	void StartSearchBehavior();
@@ -60,6 +58,7 @@ private:
 	// Override visibility handling from base class
 	virtual void HandlePlayerVisibility() override;
 	virtual void HandlePlayerLostVisibility() override;
+	virtual void OnPerceptionStateChanged(EAIPerceptionState OldState, EAIPerceptionState NewState) override;
 	
 public:
 	// Override from base class
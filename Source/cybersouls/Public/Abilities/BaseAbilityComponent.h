@@ -36,6 +36,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ability")
 	virtual void DeactivateAbility();
 
+	// Return to the freshly spawned state, used when a pooled owner is reused or the level is soft reset
+	virtual void ResetAbility();
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -23,6 +23,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
 	TArray<EBodyPart> BlockableBodyParts = { EBodyPart::UpperBody };
 
+	/** Rebuild the cached part mask CanBlock tests, call after changing BlockableBodyParts at runtime */
+	UFUNCTION(BlueprintCallable, Category = "Block")
+	void BuildBlockableMask();
+
 	UFUNCTION(BlueprintCallable, Category = "Block")
 	bool TryBlock(EBodyPart AttackedBodyPart);
 	
@@ -32,6 +36,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Block")
 	void ConsumeBlockCharge();
 
+	virtual void ResetAbility() override;
+
 protected:
 	virtual void BeginPlay() override;
+
+private:
+	// BlockableBodyParts as FBodyPartZoneTable part bits
+	uint8 BlockableMask = 0;
 };
\ No newline at end of file
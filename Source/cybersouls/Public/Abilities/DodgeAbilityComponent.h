@@ -22,6 +22,10 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dodge")
 	TArray<EBodyPart> DodgeableBodyParts = { EBodyPart::LeftLeg, EBodyPart::RightLeg };
+
+	/** Rebuild the cached part mask CanDodge tests, call after changing DodgeableBodyParts at runtime */
+	UFUNCTION(BlueprintCallable, Category = "Dodge")
+	void BuildDodgeableMask();
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dodge")
 	float DodgeDistance = 300.0f;
@@ -38,9 +42,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dodge")
 	void ConsumeDodgeCharge();
 
+	virtual void ResetAbility() override;
+
 protected:
 	virtual void BeginPlay() override;
 	
 private:
 	void PerformDodgeMovement(AActor* Attacker);
+
+	// DodgeableBodyParts as FBodyPartZoneTable part bits
+	uint8 DodgeableMask = 0;
 };
\ No newline at end of file
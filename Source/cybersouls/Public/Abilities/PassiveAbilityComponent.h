@@ -24,7 +24,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Passive")
 	EPassiveAbilityType PassiveType = EPassiveAbilityType::None;
 	
-	// Execution Chains tracking
+	// Execution Chains tracking, driven by the owner's status effects
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Passive")
 	bool bExecutionChainsActive = false;
 	
@@ -54,8 +54,5 @@ protected:
 	virtual void BeginPlay() override;
 	
 private:
-	FTimerHandle ExecutionChainsTimerHandle;
-	
 	void ActivateExecutionChains();
-	void DeactivateExecutionChains();
 };
\ No newline at end of file
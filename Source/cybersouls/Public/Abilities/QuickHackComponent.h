@@ -45,6 +45,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "QuickHack")
 	float Range = 1000.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "QuickHack")
+	float CascadeTargetRadius = 40.0f; // Added to the spread radius since enemies are found by centre, not collision
+
 	// Cascade Virus tracking
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "QuickHack")
 	TArray<AActor*> MarkedEnemies;
@@ -77,9 +80,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "QuickHack")
 	void CancelQuickHack() { InterruptQuickHack(); }
 	
+	AActor* GetCurrentTarget() const { return CurrentTarget; }
+	
+	/** Seconds spent on the current cast so far, 0 when not casting */
+	float GetCastElapsed() const { return bIsAbilityActive ? CurrentCastTime : 0.0f; }
+	
+	/**
+	 * Put cooldown and cast progress back as a checkpoint recorded them
+	 * 
+	 * @param CooldownRemaining Seconds until the QuickHack can be used again
+	 * @param CastElapsed Seconds already spent casting as GetCastElapsed reported them, ignored without a target
+	 * @param Target What the cast was aimed at, nullptr when it was not casting
+	 */
+	void RestoreCheckpointState(float CooldownRemaining, float CastElapsed, AActor* Target);
+	
 	virtual void ActivateAbility() override;
 	virtual bool CanActivateAbility() override;
+	virtual void ResetAbility() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 protected:
@@ -88,12 +107,20 @@ private:
 	UPROPERTY()
 	AActor* CurrentTarget = nullptr;
 	
+	// Subscription to UEnemyRegistrySubsystem::OnEnemyKilled
+	FDelegateHandle EnemyKilledHandle;
+	
+	// Mark expiries and delayed Cascade Virus kills, cleared by ResetAbility
+	TArray<FTimerHandle> CascadeTimers;
+	
 	void CompleteQuickHack();
 	void ApplyQuickHackEffect();
 	
 	// Cascade Virus helpers
+	void HandleRegisteredEnemyKilled(class ACybersoulsEnemyBase* KilledEnemy);
 	void MarkEnemyForCascade(AActor* Enemy);
 	void RemoveMarkFromEnemy(AActor* Enemy);
 	void TriggerCascadeEffect(AActor* KilledEnemy);
+	void AddCascadeTimer(const FTimerHandle& TimerHandle);
 	TArray<AActor*> GetNearbyEnemies(AActor* CenterEnemy, float Radius = 800.0f);
 };
\ No newline at end of file
@@ -61,6 +61,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "QuickHack")
     bool IsQuickHackCasting(int32 SlotIndex) const;
 
+    // QuickHack instance in a slot (1-4), nullptr when the slot is empty
+    UQuickHackComponent* GetQuickHackInstance(int32 SlotIndex) const;
+
     // Cancel a QuickHack that's being cast
     UFUNCTION(BlueprintCallable, Category = "QuickHack")
     void CancelQuickHack(int32 SlotIndex);
@@ -101,6 +104,9 @@ private:
     // Initialize the component with default QuickHacks
     void InitializeDefaultQuickHacks();
 
+    // Unlocks and loadout from the progression save
+    void RestoreSavedQuickHacks();
+
     // Create a QuickHack component instance
     UQuickHackComponent* CreateQuickHackInstance(EQuickHackType Type);
 
@@ -22,15 +22,26 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slash")
 	float SlashAngle = 45.0f; // Cone angle for slash
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slash")
+	float SlashTargetRadius = 40.0f; // Added to range since targets are found by centre, not collision
 
 	virtual void ActivateAbility() override;
 	virtual bool CanActivateAbility() override;
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 private:
+	// Subscription to UDamageQueueSubsystem::OnDamageResolved
+	FDelegateHandle DamageResolvedHandle;
+	
+	// Enemies hit by the last slash, so only slash kills feed passive abilities
+	TArray<TWeakObjectPtr<AActor>> PendingSlashTargets;
+	
 	void PerformSlash();
+	void HandleDamageResolved(AActor* Source, AActor* Target, float Damage, bool bKilled);
 	TArray<AActor*> GetTargetsInRange() const;
 	EBodyPart GetTargetedBodyPart() const;
 };
\ No newline at end of file
@@ -40,6 +40,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Attributes")
 	float GetIntegrity() const { return Integrity; }
 
+	// Back to full integrity, used when a pooled enemy is reused
+	virtual void ResetAttributes();
+
 protected:
 	virtual void BeginPlay() override;
 	
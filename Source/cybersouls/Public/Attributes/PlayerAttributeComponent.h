@@ -66,6 +66,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Attributes")
 	bool IsAlive() const;
 
+	// Full integrity, no hack progress and no status flags, used when the level is soft reset
+	void ResetAttributes();
+
 protected:
 	virtual void BeginPlay() override;
 	
@@ -92,6 +92,9 @@ class AcybersoulsCharacter : public ACharacter
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components, meta = (AllowPrivateAccess = "true"))
 	class UTargetingComponent* TargetingComponent;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components, meta = (AllowPrivateAccess = "true"))
+	class UStatusEffectComponent* StatusEffects;
+
 
 public:
 	AcybersoulsCharacter();
@@ -156,11 +159,21 @@ public:
 	FORCEINLINE class USlashAbilityComponent* GetSlashAbility() const { return SlashAbility; }
 	/** Returns QuickHackManager subobject **/
 	FORCEINLINE class UQuickHackManagerComponent* GetQuickHackManager() const { return QuickHackManager; }
+	/** Returns StatusEffects subobject **/
+	FORCEINLINE class UStatusEffectComponent* GetStatusEffects() const { return StatusEffects; }
+	/** Returns the passive ability component, if one was added, cached at BeginPlay **/
+	FORCEINLINE class UPassiveAbilityComponent* GetPassiveAbility() const { return CachedPassiveAbility; }
+	/** Returns DefaultMappingContext **/
+	FORCEINLINE class UInputMappingContext* GetDefaultMappingContext() const { return DefaultMappingContext; }
 
 private:
 	// Camera view state
 	bool bIsFirstPersonView = false;
 	
+	// Passive abilities are added outside the constructor, so resolve once at BeginPlay
+	UPROPERTY(Transient)
+	class UPassiveAbilityComponent* CachedPassiveAbility = nullptr;
+	
 	// Crosshair logic moved to TargetingComponent
 };
 
@@ -14,6 +14,64 @@ enum class EBodyPart : uint8
 	RightLeg UMETA(DisplayName = "Right Leg")
 };
 
+/** Capsule covering one body part, in actor local space */
+struct FBodyPartZone
+{
+	EBodyPart Part = EBodyPart::None;
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Radius = 0.0f;
+
+	FVector GetCenter() const { return (Start + End) * 0.5f; }
+};
+
+/**
+ * Body part hit zones for one character archetype
+ * 
+ * Baked once per class from the mesh's physics asset bodies, or from bone
+ * names when there is no physics asset, into actor-local capsules. Parts the
+ * mesh gives no data for get no zone, so HasPart reports what the archetype
+ * really has. Only a mesh that yields no zones at all falls back to fixed
+ * capsules around the old default body part offsets. Resolving a hit is a
+ * distance test against at most MaxZones capsules.
+ */
+struct CYBERSOULS_API FBodyPartZoneTable
+{
+	static constexpr int32 MaxZones = 3;
+
+	TArray<FBodyPartZone, TInlineAllocator<MaxZones>> Zones;
+
+	// One bit per EBodyPart present in Zones
+	uint8 PartMask = 0;
+
+	static uint8 PartBit(EBodyPart Part) { return static_cast<uint8>(1u << static_cast<uint8>(Part)); }
+
+	bool HasPart(EBodyPart Part) const { return Part != EBodyPart::None && (PartMask & PartBit(Part)) != 0; }
+
+	/** Zone for a part, or nullptr if this archetype has none */
+	const FBodyPartZone* FindZone(EBodyPart Part) const;
+
+	/**
+	 * Body part whose capsule is closest to a point
+	 * 
+	 * @param LocalPoint Point in the character's actor space
+	 * @return The closest part, or EBodyPart::None if the table is empty
+	 */
+	EBodyPart Resolve(const FVector& LocalPoint) const;
+
+	/**
+	 * Table for Character's class, baked on first request
+	 * 
+	 * @param Character Any instance of the archetype, used for its mesh and mesh offset
+	 * @return A table that stays valid for the rest of the session
+	 */
+	static const FBodyPartZoneTable& FindOrBake(const class ACharacter* Character);
+
+private:
+	static FBodyPartZoneTable Bake(const class ACharacter* Character);
+	void AddZone(EBodyPart Part, const FBox& ActorSpaceBounds);
+};
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class CYBERSOULS_API UBodyPartComponent : public USceneComponent
 {
@@ -0,0 +1,92 @@
+// DamageQueueSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "cybersouls/Public/Combat/BodyPartComponent.h"
+#include "cybersouls/Public/Interfaces/IDamageReceiver.h"
+#include "DamageQueueSubsystem.generated.h"
+
+/** One hit waiting to be resolved */
+struct FQueuedDamageEvent
+{
+	TWeakObjectPtr<AActor> Source;
+	TWeakObjectPtr<AActor> Target;
+	EBodyPart BodyPart = EBodyPart::None;
+	float Amount = 0.0f;
+	EDamageType DamageType = EDamageType::Physical;
+};
+
+/**
+ * Fired once per damaged target after a resolve pass
+ * 
+ * @param Source Actor that landed the last hit on Target this frame
+ * @param Target Actor that took the damage
+ * @param Damage Total damage applied this frame
+ * @param bKilled True if this damage killed Target
+ */
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnDamageResolved, AActor*, AActor*, float, bool);
+
+/**
+ * Frame-batched damage pipeline
+ * 
+ * Gameplay code queues hits instead of writing attributes directly. Once per
+ * frame the queue is resolved: hits are summed per target in the order each
+ * target was first hit, and each target pays for a single attribute change,
+ * damage broadcast and death check no matter how many hits it took.
+ */
+UCLASS()
+class CYBERSOULS_API UDamageQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no damage queue */
+	static UDamageQueueSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Queue a hit for this frame's resolve pass
+	 * 
+	 * @param Source Actor dealing the damage
+	 * @param Target Actor receiving the damage
+	 * @param Amount Damage before resistances
+	 * @param DamageType Damage type, TrueDamage ignores resistances
+	 * @param BodyPart Body part that was hit, if any
+	 */
+	void QueueDamage(AActor* Source, AActor* Target, float Amount, EDamageType DamageType = EDamageType::Physical, EBodyPart BodyPart = EBodyPart::None);
+
+	/** Apply everything queued so far. Called automatically once per frame. */
+	void ResolvePendingDamage();
+
+	bool HasPendingDamage() const { return PendingEvents.Num() > 0; }
+
+	/** Drop everything queued without applying it, for resets that respawn the targets */
+	void DiscardPendingDamage();
+
+	/** Fired once per damaged target during a resolve pass */
+	FOnDamageResolved OnDamageResolved;
+
+private:
+	// Per-target accumulation for one resolve pass
+	struct FTargetDamage
+	{
+		AActor* Target = nullptr;
+		AActor* LastSource = nullptr;
+		TCachedInterface<IDamageReceiver> Receiver;
+		EBodyPart LastBodyPart = EBodyPart::None;
+		float Total = 0.0f;
+	};
+
+	TArray<FQueuedDamageEvent> PendingEvents;
+
+	// Scratch storage reused between frames
+	TArray<FTargetDamage> TargetTotals;
+	TMap<AActor*, int32> TargetIndices;
+
+	float ApplyResistance(const FTargetDamage& Damage, float Amount, EDamageType DamageType) const;
+	bool ApplyTotalDamage(const FTargetDamage& Damage);
+};
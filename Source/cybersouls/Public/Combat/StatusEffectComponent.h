@@ -0,0 +1,134 @@
+// StatusEffectComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "StatusEffectComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class EStatusEffectType : uint8
+{
+	None UMETA(DisplayName = "None"),
+	SystemFreeze UMETA(DisplayName = "System Freeze"),
+	Firewall UMETA(DisplayName = "Firewall"),
+	GhostProtocol UMETA(DisplayName = "Ghost Protocol"),
+	GravityFlip UMETA(DisplayName = "Gravity Flip"),
+	ExecutionChains UMETA(DisplayName = "Execution Chains")
+};
+
+/** What happens when an effect that is already active is applied again */
+UENUM(BlueprintType)
+enum class EStatusEffectStackRule : uint8
+{
+	// Expire Duration from now, unless the current expiry is later
+	Refresh UMETA(DisplayName = "Refresh"),
+	// Add Duration to the remaining time
+	Extend UMETA(DisplayName = "Extend"),
+	// Add a stack up to MaxStacks and refresh the expiry
+	Stack UMETA(DisplayName = "Stack")
+};
+
+/** One active effect slot */
+struct FActiveStatusEffect
+{
+	EStatusEffectType Type = EStatusEffectType::None;
+	double ExpireTime = 0.0;
+	int32 StackCount = 1;
+
+	// State overwritten by the effect, restored when it ends
+	float SavedValue = 0.0f;
+};
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnStatusEffectChanged, class UStatusEffectComponent*, EStatusEffectType, bool);
+
+/**
+ * Timed status effects on a single combatant
+ * 
+ * Holds a fixed number of effect slots with expiry timestamps. The component
+ * never ticks itself: while it has active effects it is registered with
+ * UStatusEffectSubsystem, which expires every combatant's effects in one pass
+ * per frame. Starting and ending an effect writes the matching flag on the
+ * owner (immobilized, firewall, invisibility, gravity, execution chains), so
+ * the rest of the game keeps reading the same state as before.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class CYBERSOULS_API UStatusEffectComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UStatusEffectComponent();
+
+	/** Most effects a single combatant can carry at once */
+	static constexpr int32 MaxActiveEffects = 8;
+
+	/**
+	 * Start an effect, or re-apply it according to StackRule
+	 * 
+	 * @param Type Effect to apply
+	 * @param Duration Seconds the effect lasts (or is extended by)
+	 * @param StackRule How to combine with an already active effect of the same type
+	 * @param MaxStacks Stack limit for EStatusEffectStackRule::Stack
+	 * @return False if the effect could not be applied (invalid input or no free slot)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	bool ApplyEffect(EStatusEffectType Type, float Duration, EStatusEffectStackRule StackRule = EStatusEffectStackRule::Refresh, int32 MaxStacks = 1);
+
+	/** End an effect early. Returns false if it was not active. */
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	bool RemoveEffect(EStatusEffectType Type);
+
+	/** End every active effect */
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	void ClearAllEffects();
+
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	bool HasEffect(EStatusEffectType Type) const { return FindEffectIndex(Type) != INDEX_NONE; }
+
+	/** Seconds left on an effect, 0 if it is not active */
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	float GetRemainingTime(EStatusEffectType Type) const;
+
+	/** Stacks of an effect, 0 if it is not active */
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	int32 GetStackCount(EStatusEffectType Type) const;
+
+	bool HasActiveEffects() const { return ActiveEffects.Num() > 0; }
+	int32 GetActiveEffectCount() const { return ActiveEffects.Num(); }
+
+	/**
+	 * End every effect whose expiry is at or before Now
+	 * 
+	 * Called by UStatusEffectSubsystem during its batched pass.
+	 * 
+	 * @param Now Current world time in seconds
+	 */
+	void ExpireEffects(double Now);
+
+	/** Fired when an effect starts (true) or ends (false), not on refresh */
+	FOnStatusEffectChanged OnStatusEffectChanged;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	TArray<FActiveStatusEffect, TInlineAllocator<MaxActiveEffects>> ActiveEffects;
+
+	// Owner state touched by effects, resolved once
+	UPROPERTY(Transient)
+	class UPlayerAttributeComponent* PlayerAttributes = nullptr;
+
+	UPROPERTY(Transient)
+	class UCharacterMovementComponent* CharacterMovement = nullptr;
+
+	UPROPERTY(Transient)
+	class UPassiveAbilityComponent* PassiveAbility = nullptr;
+
+	int32 FindEffectIndex(EStatusEffectType Type) const;
+	void RemoveEffectAt(int32 Index);
+
+	// Write the owner state for an effect that just started or ended
+	void StartEffect(FActiveStatusEffect& Effect);
+	void EndEffect(const FActiveStatusEffect& Effect);
+};
@@ -0,0 +1,38 @@
+// StatusEffectSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatusEffectSubsystem.generated.h"
+
+class UStatusEffectComponent;
+
+/**
+ * Expires status effects for every combatant in one pass per frame
+ * 
+ * Only components that currently carry effects are registered, so idle
+ * combatants cost nothing. Replaces one timer per applied effect.
+ */
+UCLASS()
+class CYBERSOULS_API UStatusEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no subsystem */
+	static UStatusEffectSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Start processing a component's effects. Safe to call more than once. */
+	void RegisterComponent(UStatusEffectComponent* Component);
+
+	/** Stop processing a component's effects. Safe to call more than once. */
+	void UnregisterComponent(UStatusEffectComponent* Component);
+
+private:
+	UPROPERTY()
+	TArray<UStatusEffectComponent*> ActiveComponents;
+};
@@ -59,20 +59,73 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target Lock")
 	TSubclassOf<AActor> EnemyClass;
 
+	// How often the lock candidate set is rebuilt, in seconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target Lock")
+	float CandidateRefreshInterval = 0.1f;
+
+	// Oldest batched line-of-sight result a candidate may be admitted on, in seconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target Lock")
+	float MaxCandidateLineOfSightAge = 0.2f;
+
+	// How often the current lock is re-validated, in seconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target Lock")
+	float LockValidityInterval = 0.1f;
+
+	// How long the locked target may stay occluded before the lock drops, in seconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target Lock")
+	float OcclusionGraceTime = 0.5f;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
+	/** Lockable enemy with its precomputed ordering keys */
+	struct FLockCandidate
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		// Signed yaw from the owner's forward, negative is left
+		float AngleKey = 0.0f;
+
+		// FindBestTarget ranking, higher is better
+		float Score = 0.0f;
+	};
+
 	UPROPERTY()
 	AActor* CurrentTarget = nullptr;
 
 	UPROPERTY()
 	EBodyPart TargetedBodyPart = EBodyPart::UpperBody;
 
-	AActor* FindBestTarget() const;
-	TArray<AActor*> GetValidTargets() const;
+	// Sorted left to right by AngleKey
+	TArray<FLockCandidate> Candidates;
+	int32 CurrentCandidateIndex = INDEX_NONE;
+	int32 BestCandidateIndex = INDEX_NONE;
+	double LastCandidateRefreshTime = -1.0;
+
+	// Lock upkeep
+	double LastValidityCheckTime = 0.0;
+	double LastTargetVisibleTime = 0.0;
+
+	// Cosine of MaxLockAngle, recomputed only when the angle changes
+	mutable float LockAngleCosine = 0.0f;
+	mutable float LockAngleCosineSource = -1.0f;
+
+	/** Rebuild the candidate set if it is older than CandidateRefreshInterval */
+	void RefreshCandidates();
+
+	/** Step through the candidate set, Direction is -1 for left and +1 for right */
+	void CycleTarget(int32 Direction);
+
+	/** Lock a target already validated by the candidate refresh */
+	void SetLockedTarget(AActor* Target);
+
+	AActor* FindBestTarget();
 	bool IsValidTarget(AActor* Target) const;
+
+	/** Liveness, distance and angle checks of IsValidTarget, without the line-of-sight trace */
+	bool IsWithinLockCone(AActor* Target) const;
 	void UpdateLockValidity();
 	UBodyPartComponent* GetBodyPartComponent(AActor* Actor, EBodyPart BodyPart) const;
 };
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "cybersouls/Public/CybersoulsUtils.h"
+#include "cybersouls/cybersouls.h"
+#include "cybersouls/Public/Interfaces/ITargetable.h"
 #include "TargetingComponent.generated.h"
 
 // Forward declarations
@@ -14,6 +16,11 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnBodyPartChanged, EBodyPart);
 
 /**
  * Component that handles crosshair targeting and body part detection
+ * 
+ * The crosshair trace only runs when something could have changed its
+ * result: the camera moved, an enemy near the last traced ray moved, the
+ * viewport was resized, or MaxTraceInterval passed. Otherwise the previous
+ * target and body part are kept.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class CYBERSOULS_API UTargetingComponent : public UActorComponent
@@ -27,8 +34,27 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "Targeting")
     float MaxTargetingRange = 5000.0f;
 
+    // Traced against simple collision only
     UPROPERTY(EditDefaultsOnly, Category = "Targeting")
-    TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Pawn;
+    TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Targeting;
+
+    // Camera movement below these limits does not trigger a new trace
+    UPROPERTY(EditDefaultsOnly, Category = "Targeting|Performance")
+    float CameraMoveTolerance = 0.5f;
+
+    UPROPERTY(EditDefaultsOnly, Category = "Targeting|Performance")
+    float CameraRotationTolerance = 0.0001f;
+
+    // Enemies closer than this to the last traced ray are watched for movement
+    UPROPERTY(EditDefaultsOnly, Category = "Targeting|Performance")
+    float NearbyEnemyRadius = 150.0f;
+
+    UPROPERTY(EditDefaultsOnly, Category = "Targeting|Performance")
+    float EnemyMoveTolerance = 2.0f;
+
+    // Longest the last result is reused, catches targets that are not registered enemies, in seconds
+    UPROPERTY(EditDefaultsOnly, Category = "Targeting|Performance")
+    float MaxTraceInterval = 0.25f;
 
     UPROPERTY(EditDefaultsOnly, Category = "Targeting")
     bool bDebugDrawTrace = false;
@@ -55,6 +81,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
@@ -66,7 +93,48 @@ private:
 
     EBodyPart CurrentBodyPart;
 
+    // What the last trace saw, for deciding whether the next one can be skipped
+    struct FNearbyEnemySnapshot
+    {
+        TWeakObjectPtr<const AActor> Enemy;
+        FVector Location;
+    };
+
+    bool bHasTraceSnapshot = false;
+    double LastTraceTime = 0.0;
+    FVector LastCameraLocation = FVector::ZeroVector;
+    FQuat LastCameraRotation = FQuat::Identity;
+    FVector LastRayStart = FVector::ZeroVector;
+    FVector LastRayEnd = FVector::ZeroVector;
+    FVector LastTargetLocation = FVector::ZeroVector;
+    TArray<FNearbyEnemySnapshot> NearbyEnemySnapshot;
+
+    // Scratch buffer for registry queries
+    TArray<ACybersoulsEnemyBase*> NearbyEnemyScratch;
+
+    // Dispatch path for the last actor checked for ITargetable
+    mutable TCachedInterface<ITargetable> TargetableHandle;
+
+    // Viewport center, recomputed after a resize
+    mutable FVector2D CachedScreenCenter = FVector2D::ZeroVector;
+    mutable bool bScreenCenterValid = false;
+    FDelegateHandle ViewportResizedHandle;
+
     void UpdateTargeting();
     void DetermineBodyPart(const FHitResult& HitResult);
     FVector2D GetScreenCenter() const;
+
+    /** Cached ITargetable handle for Actor, re-resolved only when the actor changes */
+    const TCachedInterface<ITargetable>& ResolveTargetable(AActor* Actor) const;
+
+    /** Crosshair trace that also reports the traced ray, clipped at the hit */
+    bool TraceCrosshair(FHitResult& OutHit, FVector& OutRayStart, FVector& OutRayEnd) const;
+
+    /** True if the camera, the target or enemies near the last ray changed enough to need a new trace */
+    bool NeedsRetrace();
+
+    /** Gather registered enemies within NearbyEnemyRadius of the ray into NearbyEnemyScratch */
+    void GatherEnemiesNearRay(const FVector& RayStart, const FVector& RayEnd);
+
+    void OnViewportResized(FViewport* Viewport, uint32 Unused);
 };
\ No newline at end of file
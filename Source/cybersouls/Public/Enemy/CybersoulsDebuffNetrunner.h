@@ -29,6 +29,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void InitializeEnemy() override;
+	virtual void ResetForReuse() override;
 	virtual void TickActor(float DeltaTime, ELevelTick TickType, FActorTickFunction& ThisTickFunction) override;
 	
 private:
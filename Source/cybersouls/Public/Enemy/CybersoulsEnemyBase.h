@@ -37,6 +37,9 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UBodyPartComponent* RightLegPart;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	class UStatusEffectComponent* StatusEffects;
+
 	UFUNCTION(BlueprintCallable, Category = "Enemy")
 	virtual void InitializeEnemy();
 
@@ -58,25 +61,76 @@ public:
 	// Check if enemy is dead
 	bool IsDead() const { return bIsDead; }
 
+	/** Cached components, resolved once in InitializeEnemy. Null when this enemy type lacks them. */
+	FORCEINLINE class UEnemyAttributeComponent* GetEnemyAttributes() const { return CachedEnemyAttributes; }
+	FORCEINLINE class UPhysicalEnemyAttributeComponent* GetPhysicalAttributes() const { return CachedPhysicalAttributes; }
+	FORCEINLINE class UHackingEnemyAttributeComponent* GetHackingAttributes() const { return CachedHackingAttributes; }
+	FORCEINLINE class UAttackAbilityComponent* GetAttackAbility() const { return CachedAttackAbility; }
+	FORCEINLINE class UBlockAbilityComponent* GetBlockAbility() const { return CachedBlockAbility; }
+	FORCEINLINE class UDodgeAbilityComponent* GetDodgeAbility() const { return CachedDodgeAbility; }
+	FORCEINLINE class UHackAbilityComponent* GetHackAbility() const { return CachedHackAbility; }
+	FORCEINLINE const TArray<class UQuickHackComponent*>& GetQuickHacks() const { return CachedQuickHacks; }
+	FORCEINLINE class UStatusEffectComponent* GetStatusEffects() const { return StatusEffects; }
+
+	/** Component lookups made by every enemy so far; flat while enemies run on the cache */
+	static int32 GetNumComponentLookups() { return NumComponentLookups; }
+
+	/** Body part hit zones shared by every enemy of this class, baked on first use */
+	const FBodyPartZoneTable& GetBodyPartZones() const;
+
+	/**
+	 * Body part under a world-space point
+	 * 
+	 * @param WorldLocation Usually a trace hit location on this enemy
+	 * @return The part whose hit zone is closest to the point
+	 */
+	EBodyPart ResolveBodyPart(const FVector& WorldLocation) const;
+
+	bool HasBodyPart(EBodyPart Part) const { return GetBodyPartZones().HasPart(Part); }
+
+	/**
+	 * Hide the enemy and stop everything it runs, for UEnemyPoolSubsystem
+	 * 
+	 * The enemy stays dead, leaves the registry and its controller is
+	 * unpossessed and kept for ActivateFromPool.
+	 */
+	void DeactivateForPool();
+
+	/**
+	 * Bring a parked enemy back into play as if it had just been spawned
+	 * 
+	 * @param SpawnTransform Where the enemy appears
+	 */
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
+	bool IsInPool() const { return bInPool; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 	UFUNCTION()
 	void OnDeath();
 
 	// Handle ragdoll death sequence
 	virtual void StartDeathSequence();
+
+	// Reset attributes, abilities and status effects before reuse from the pool
+	virtual void ResetForReuse();
 	
-	// Shatter death effect components
-	// Note: We create skeletal mesh pieces dynamically
+	// Shatter death effect, pieces come from UDebrisPoolSubsystem
 	
-	// Create shattered mesh pieces
+	// Launch pooled debris pieces
 	void CreateShatteredPieces();
 	
 	// Number of shatter pieces to create
 	UPROPERTY(EditDefaultsOnly, Category = "Death Effect")
 	int32 ShatterPieceCount = 50;
 
+	// Mesh for each piece, the pool's default mesh when unset
+	UPROPERTY(EditDefaultsOnly, Category = "Death Effect")
+	class UStaticMesh* ShatterPieceMesh = nullptr;
+
 	// Default AI Controller class to use
 	virtual TSubclassOf<AController> GetDefaultControllerClass() const;
 
@@ -84,6 +138,9 @@ protected:
 	void SetupAttributesForType();
 	void SetupAbilitiesForType();
 
+	// Resolve the component cache; called from InitializeEnemy
+	void CacheComponents();
+
 protected:
 	UPROPERTY()
 	AActor* CurrentTarget = nullptr;
@@ -93,6 +150,45 @@ protected:
 
 	// Track death state
 	bool bIsDead = false;
+
+	// Component cache, so hot paths never need FindComponentByClass
+	UPROPERTY(Transient)
+	class UEnemyAttributeComponent* CachedEnemyAttributes = nullptr;
+
+	UPROPERTY(Transient)
+	class UPhysicalEnemyAttributeComponent* CachedPhysicalAttributes = nullptr;
+
+	UPROPERTY(Transient)
+	class UHackingEnemyAttributeComponent* CachedHackingAttributes = nullptr;
+
+	UPROPERTY(Transient)
+	class UAttackAbilityComponent* CachedAttackAbility = nullptr;
+
+	UPROPERTY(Transient)
+	class UBlockAbilityComponent* CachedBlockAbility = nullptr;
+
+	UPROPERTY(Transient)
+	class UDodgeAbilityComponent* CachedDodgeAbility = nullptr;
+
+	UPROPERTY(Transient)
+	class UHackAbilityComponent* CachedHackAbility = nullptr;
+
+	UPROPERTY(Transient)
+	TArray<class UQuickHackComponent*> CachedQuickHacks;
+
+	// Per-class table owned by FBodyPartZoneTable, see GetBodyPartZones
+	mutable const FBodyPartZoneTable* BodyPartZones = nullptr;
+
+	// Parked in UEnemyPoolSubsystem
+	bool bInPool = false;
+
+	// Controller kept while parked, possesses the enemy again on reuse
+	UPROPERTY(Transient)
+	AController* ParkedController = nullptr;
+
+	// Components that were ticking when the enemy was parked
+	UPROPERTY(Transient)
+	TArray<UActorComponent*> ParkedTickingComponents;
 	
 private:
 	FTimerHandle AttackTimerHandle;
@@ -105,4 +201,10 @@ private:
 	
 	// Helper functions
 	void StartBehaviorTimers();
+
+	// Counted FindComponentByClass, only CacheComponents should need it
+	template<typename T>
+	T* LookupComponent();
+
+	static int32 NumComponentLookups;
 };
\ No newline at end of file
@@ -23,4 +23,5 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void InitializeEnemy() override;
+	virtual void ResetForReuse() override;
 };
\ No newline at end of file
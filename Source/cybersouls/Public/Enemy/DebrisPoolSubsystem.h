@@ -0,0 +1,129 @@
+// DebrisPoolSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DebrisPoolSubsystem.generated.h"
+
+class UStaticMesh;
+class UStaticMeshComponent;
+class UMaterialInterface;
+
+/** Launch parameters for one debris piece */
+struct FDebrisPieceSpawn
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float Scale = 1.0f;
+	FVector Impulse = FVector::ZeroVector;
+	FVector AngularImpulse = FVector::ZeroVector;
+};
+
+/** Pooled pieces sharing one static mesh */
+USTRUCT()
+struct FDebrisMeshPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UStaticMeshComponent*> FreePieces;
+
+	// Pieces created for this mesh, live or free
+	int32 TotalPieces = 0;
+};
+
+/**
+ * World-wide pool of shatter debris
+ *
+ * Enemy archetypes pre-warm static mesh pieces when they begin play, and a
+ * shatter takes pieces from the pool instead of creating components. Live
+ * pieces are put to sleep after PieceSleepTime and returned to the pool after
+ * PieceLifetime. A global MaxLivePieces budget is enforced by recycling the
+ * oldest live pieces first, so once warmed up a shatter allocates nothing.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UDebrisPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no debris pool */
+	static UDebrisPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Make sure enough pieces exist for one archetype's shatter
+	 *
+	 * @param Mesh Piece mesh, nullptr for DefaultPieceMesh
+	 * @param PieceCount Pieces a single shatter of this archetype uses
+	 */
+	void PrewarmPieces(UStaticMesh* Mesh, int32 PieceCount);
+
+	/**
+	 * Launch one piece of debris
+	 *
+	 * Reuses a free piece, grows the pool while under budget, and otherwise
+	 * recycles the oldest live piece.
+	 *
+	 * @param Mesh Piece mesh, nullptr for DefaultPieceMesh
+	 * @param Material Material for the piece, usually from the dying mesh
+	 * @param Spawn Where to place the piece and how to launch it
+	 */
+	void SpawnPiece(UStaticMesh* Mesh, UMaterialInterface* Material, const FDebrisPieceSpawn& Spawn);
+
+	/** Return every live piece to the pool at once, used when the level is soft reset */
+	void ReleaseAllPieces();
+
+	int32 GetLivePieceCount() const { return LivePieces.Num(); }
+
+	// Used when an archetype does not set its own piece mesh
+	UPROPERTY(Config)
+	FSoftObjectPath DefaultPieceMesh = FSoftObjectPath(TEXT("/Engine/BasicShapes/Cube.Cube"));
+
+	// Most pieces simulating or visible at once
+	UPROPERTY(Config)
+	int32 MaxLivePieces = 400;
+
+	// Shatters per archetype to pre-warm pieces for
+	UPROPERTY(Config)
+	int32 PrewarmShattersPerArchetype = 2;
+
+	// Seconds after launch a piece stops simulating
+	UPROPERTY(Config)
+	float PieceSleepTime = 2.0f;
+
+	// Seconds after launch a piece is hidden and returned to the pool
+	UPROPERTY(Config)
+	float PieceLifetime = 3.0f;
+
+private:
+	struct FLivePiece
+	{
+		UStaticMeshComponent* Piece = nullptr;
+		UStaticMesh* Mesh = nullptr;
+		double SpawnTime = 0.0;
+		bool bSleeping = false;
+	};
+
+	// Owns every piece component
+	UPROPERTY()
+	AActor* PoolOwner = nullptr;
+
+	UPROPERTY()
+	TMap<UStaticMesh*, FDebrisMeshPool> MeshPools;
+
+	UPROPERTY()
+	UStaticMesh* LoadedDefaultMesh = nullptr;
+
+	// Oldest first
+	TArray<FLivePiece> LivePieces;
+
+	UStaticMesh* ResolveMesh(UStaticMesh* Mesh);
+	UStaticMeshComponent* CreatePiece(UStaticMesh* Mesh);
+	UStaticMeshComponent* AcquirePiece(UStaticMesh* Mesh);
+	void ReleasePiece(const FLivePiece& LivePiece);
+	int32 GetTotalPieceCount() const;
+};
@@ -0,0 +1,90 @@
+// EnemyPoolSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyPoolSubsystem.generated.h"
+
+class ACybersoulsEnemyBase;
+
+/** Parked enemies of one class */
+USTRUCT()
+struct FEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACybersoulsEnemyBase*> FreeEnemies;
+};
+
+/**
+ * World-wide pool of enemy actors
+ *
+ * A dead enemy is deactivated and parked here once its death sequence ends
+ * instead of being destroyed, keeping its AI controller, components and baked
+ * body part zones. SpawnEnemy hands parked enemies back out with their
+ * attributes, abilities and timers reset, re-possessed by their controller and
+ * registered with the game mode, and only spawns a new actor when the class has
+ * nothing parked.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no enemy pool */
+	static UEnemyPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Bring an enemy into play, reusing a parked one when possible
+	 *
+	 * @param EnemyClass Class to spawn
+	 * @param Transform Where the enemy appears
+	 * @return The active enemy, or nullptr if the class is invalid or spawning failed
+	 */
+	ACybersoulsEnemyBase* SpawnEnemy(TSubclassOf<ACybersoulsEnemyBase> EnemyClass, const FTransform& Transform);
+
+	/**
+	 * Deactivate an enemy and park it for reuse
+	 *
+	 * @param Enemy Enemy whose death sequence has finished
+	 * @return False if its class is already at MaxPooledPerClass, the caller should destroy it
+	 */
+	bool ReleaseEnemy(ACybersoulsEnemyBase* Enemy);
+
+	/**
+	 * Park every enemy in the world, alive, dying or dead, ahead of repopulating it
+	 *
+	 * Ignores MaxPooledPerClass since the caller is about to spawn them back.
+	 *
+	 * @return Number of enemies parked
+	 */
+	int32 ReleaseAllEnemies();
+
+	/**
+	 * Spawn and park enemies so later SpawnEnemy calls never create actors
+	 *
+	 * @param EnemyClass Class to pre-warm
+	 * @param Count Parked enemies wanted for the class, capped at MaxPooledPerClass
+	 */
+	void PrewarmEnemies(TSubclassOf<ACybersoulsEnemyBase> EnemyClass, int32 Count);
+
+	int32 GetFreeEnemyCount(TSubclassOf<ACybersoulsEnemyBase> EnemyClass) const;
+
+	// Most parked enemies kept per class, extras are destroyed on release
+	UPROPERTY(Config)
+	int32 MaxPooledPerClass = 32;
+
+	// Where pre-warmed enemies are spawned before being parked, out of sight
+	UPROPERTY(Config)
+	FVector ParkingLocation = FVector(0.0f, 0.0f, -100000.0f);
+
+private:
+	UPROPERTY()
+	TMap<UClass*, FEnemyPoolBucket> Buckets;
+
+	ACybersoulsEnemyBase* CreateEnemy(UClass* EnemyClass, const FTransform& Transform);
+};
@@ -0,0 +1,96 @@
+// EnemyRegistrySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "cybersouls/Public/Enemy/EnemySpatialGrid.h"
+#include "EnemyRegistrySubsystem.generated.h"
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRegisteredEnemyKilled, ACybersoulsEnemyBase*);
+
+/** Enemies of a single EEnemyType */
+USTRUCT()
+struct FEnemyTypeBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACybersoulsEnemyBase*> Enemies;
+};
+
+/**
+ * World-wide registry of live enemies
+ *
+ * Enemies register themselves in BeginPlay and unregister on death or EndPlay.
+ * Keeps a dense array of all live enemies plus one bucket per EEnemyType so
+ * gameplay code never has to scan the world with GetAllActorsOfClass, and a
+ * spatial hash of their positions for neighbour queries. The hash is refreshed
+ * once per tick, so query results can lag movement by at most one frame.
+ */
+UCLASS()
+class CYBERSOULS_API UEnemyRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor, returns nullptr if the world has no registry */
+	static UEnemyRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Add a live enemy. Ignores dead, invalid and already registered enemies. */
+	void RegisterEnemy(ACybersoulsEnemyBase* Enemy);
+
+	/** Remove an enemy. Safe to call more than once. */
+	void UnregisterEnemy(ACybersoulsEnemyBase* Enemy);
+
+	/**
+	 * Remove a dying enemy and notify OnEnemyKilled listeners
+	 *
+	 * @param Enemy The enemy that just died
+	 */
+	void NotifyEnemyKilled(ACybersoulsEnemyBase* Enemy);
+
+	bool IsRegistered(const ACybersoulsEnemyBase* Enemy) const { return DenseIndices.Contains(Enemy); }
+
+	/** All live enemies, densely packed. Order is not stable across removals. */
+	const TArray<ACybersoulsEnemyBase*>& GetLiveEnemies() const { return LiveEnemies; }
+
+	/** Live enemies of a single type */
+	const TArray<ACybersoulsEnemyBase*>& GetEnemiesOfType(EEnemyType Type) const;
+
+	int32 GetLiveEnemyCount() const { return LiveEnemies.Num(); }
+
+	/** Live enemies within Radius of Origin. OutEnemies is appended to. */
+	void QueryRadius(const FVector& Origin, float Radius, TArray<ACybersoulsEnemyBase*>& OutEnemies) const { SpatialGrid.QueryRadius(Origin, Radius, OutEnemies); }
+
+	/** Live enemies within Radius of Origin and HalfAngleDegrees of Direction. OutEnemies is appended to. */
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<ACybersoulsEnemyBase*>& OutEnemies) const { SpatialGrid.QueryCone(Origin, Direction, Radius, HalfAngleDegrees, OutEnemies); }
+
+	/** Live enemies inside Box. OutEnemies is appended to. */
+	void QueryBox(const FBox& Box, TArray<ACybersoulsEnemyBase*>& OutEnemies) const { SpatialGrid.QueryBox(Box, OutEnemies); }
+
+	/** Fired after a killed enemy has been removed from the registry */
+	FOnRegisteredEnemyKilled OnEnemyKilled;
+
+private:
+	UPROPERTY()
+	TArray<ACybersoulsEnemyBase*> LiveEnemies;
+
+	// Indexed by EEnemyType
+	UPROPERTY()
+	TArray<FEnemyTypeBucket> TypeBuckets;
+
+	// Enemy -> slot in LiveEnemies, for O(1) swap removal
+	TMap<const ACybersoulsEnemyBase*, int32> DenseIndices;
+
+	// Type each enemy was bucketed under, in case EnemyType changes while registered
+	TMap<const ACybersoulsEnemyBase*, EEnemyType> RegisteredTypes;
+
+	FEnemySpatialGrid SpatialGrid;
+
+	FEnemyTypeBucket& GetBucket(EEnemyType Type);
+};
@@ -0,0 +1,62 @@
+// EnemySpatialGrid.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ACybersoulsEnemyBase;
+
+/**
+ * Uniform spatial hash of enemy positions
+ *
+ * Enemies are bucketed by their XY cell; height is only considered by the exact
+ * per-candidate tests. Owned and kept up to date by UEnemyRegistrySubsystem, which
+ * also guarantees every pointer stored here is unregistered before it goes away.
+ */
+class CYBERSOULS_API FEnemySpatialGrid
+{
+public:
+	explicit FEnemySpatialGrid(float InCellSize = 1000.0f);
+
+	void Insert(ACybersoulsEnemyBase* Enemy, const FVector& Location);
+	void Remove(const ACybersoulsEnemyBase* Enemy);
+
+	/** Re-hash an enemy if it has crossed into a new cell. Cheap when it has not. */
+	void Update(ACybersoulsEnemyBase* Enemy, const FVector& Location);
+
+	void Reset();
+
+	/**
+	 * Collect enemies within Radius of Origin
+	 *
+	 * @param Origin Query centre
+	 * @param Radius Query radius, tested against actor location
+	 * @param OutEnemies Appended to, not cleared
+	 */
+	void QueryRadius(const FVector& Origin, float Radius, TArray<ACybersoulsEnemyBase*>& OutEnemies) const;
+
+	/**
+	 * Collect enemies within Radius of Origin and within HalfAngleDegrees of Direction
+	 *
+	 * @param Direction Cone axis, does not need to be normalized
+	 */
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<ACybersoulsEnemyBase*>& OutEnemies) const;
+
+	/** Collect enemies whose location lies inside Box */
+	void QueryBox(const FBox& Box, TArray<ACybersoulsEnemyBase*>& OutEnemies) const;
+
+	float GetCellSize() const { return CellSize; }
+	int32 Num() const { return EnemyCells.Num(); }
+
+private:
+	float CellSize;
+	float InvCellSize;
+
+	TMap<FIntPoint, TArray<ACybersoulsEnemyBase*>> Cells;
+	TMap<const ACybersoulsEnemyBase*, FIntPoint> EnemyCells;
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void RemoveFromCell(const ACybersoulsEnemyBase* Enemy, const FIntPoint& Cell);
+
+	template <typename PredicateType>
+	void ForEachInCells(const FVector& Min, const FVector& Max, PredicateType&& Predicate, TArray<ACybersoulsEnemyBase*>& OutEnemies) const;
+};
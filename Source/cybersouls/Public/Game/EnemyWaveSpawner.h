@@ -0,0 +1,172 @@
+// EnemyWaveSpawner.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "cybersouls/Public/Enemy/CybersoulsEnemyBase.h"
+#include "EnemyWaveSpawner.generated.h"
+
+struct FStreamableHandle;
+
+/** Enemies of one type in a wave */
+USTRUCT(BlueprintType)
+struct FEnemyWaveEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave")
+	EEnemyType EnemyType = EEnemyType::Basic;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave", meta = (ClampMin = "1"))
+	int32 Count = 1;
+
+	// Indices into the spawner's SpawnPoints, every spawn point when empty
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave")
+	TArray<int32> SpawnPointIndices;
+};
+
+USTRUCT(BlueprintType)
+struct FEnemyWave
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave")
+	TArray<FEnemyWaveEntry> Entries;
+
+	// Seconds after the previous wave is cleared (or waves start) before this one spawns
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave", meta = (ClampMin = "0.0"))
+	float StartDelay = 3.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnemyWaveEvent, int32, WaveIndex);
+
+/**
+ * Spawns data-driven waves of enemies
+ *
+ * Each wave's enemy classes (and the meshes they reference) are loaded
+ * asynchronously through the asset manager one wave ahead, then pre-warmed
+ * into UEnemyPoolSubsystem while the current wave is being fought. Spawns are
+ * staggered across frames under MaxSpawnsPerFrame, and the game mode holds off
+ * CompleteQuest while any spawner still has waves pending.
+ */
+UCLASS()
+class CYBERSOULS_API AEnemyWaveSpawner : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AEnemyWaveSpawner();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waves")
+	TArray<FEnemyWave> Waves;
+
+	// Class spawned for each enemy type, soft so a wave only loads what it uses
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waves")
+	TMap<EEnemyType, TSoftClassPtr<ACybersoulsEnemyBase>> EnemyClasses;
+
+	// Where enemies appear, the spawner itself when empty
+	UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category = "Waves")
+	TArray<AActor*> SpawnPoints;
+
+	// Enemies sharing a spawn point are scattered within this radius
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waves", meta = (ClampMin = "0.0"))
+	float SpawnScatterRadius = 150.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waves")
+	bool bStartOnBeginPlay = true;
+
+	// Enemies brought into play per frame, the rest wait for following frames
+	UPROPERTY(EditAnywhere, Category = "Waves|Budget", meta = (ClampMin = "1"))
+	int32 MaxSpawnsPerFrame = 4;
+
+	// Enemies pre-warmed into the pool per frame between spawns
+	UPROPERTY(EditAnywhere, Category = "Waves|Budget", meta = (ClampMin = "0"))
+	int32 MaxPrewarmsPerFrame = 1;
+
+	// A single spawn or pre-warm slower than this is reported as a hitch
+	UPROPERTY(EditAnywhere, Category = "Waves|Budget", meta = (ClampMin = "0.0"))
+	float SpawnHitchThresholdMs = 2.0f;
+
+	UPROPERTY(BlueprintAssignable, Category = "Waves")
+	FOnEnemyWaveEvent OnWaveStarted;
+
+	UPROPERTY(BlueprintAssignable, Category = "Waves")
+	FOnEnemyWaveEvent OnWaveCleared;
+
+	UFUNCTION(BlueprintCallable, Category = "Waves")
+	void StartWaves();
+
+	/** Back to before the first wave, restarting if bStartOnBeginPlay; waves already cleared load their classes again */
+	void ResetWaves();
+
+	/** True from StartWaves until the last wave is cleared */
+	UFUNCTION(BlueprintCallable, Category = "Waves")
+	bool HasPendingWaves() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Waves")
+	int32 GetCurrentWaveIndex() const { return CurrentWave; }
+
+	virtual void Tick(float DeltaTime) override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	enum class EWavePhase : uint8
+	{
+		Idle,
+		Waiting,
+		Spawning,
+		Fighting,
+		Finished
+	};
+
+	struct FPendingSpawn
+	{
+		TSubclassOf<ACybersoulsEnemyBase> EnemyClass;
+		FTransform Transform;
+	};
+
+	struct FPendingPrewarm
+	{
+		TSubclassOf<ACybersoulsEnemyBase> EnemyClass;
+		int32 WantedFree = 0;
+		int32 WaveIndex = INDEX_NONE;
+	};
+
+	EWavePhase Phase = EWavePhase::Idle;
+	int32 CurrentWave = INDEX_NONE;
+
+	// World time the current wave may start spawning
+	double WaveReadyTime = 0.0;
+
+	// Spawns for the current wave, consumed front to back
+	TArray<FPendingSpawn> PendingSpawns;
+	int32 NextPendingSpawn = 0;
+
+	TArray<FPendingPrewarm> PendingPrewarms;
+
+	// Enemies of the current wave that have not died yet
+	TSet<TWeakObjectPtr<ACybersoulsEnemyBase>> AliveWaveEnemies;
+
+	// Keeps each requested wave's classes loaded, indexed like Waves
+	TArray<TSharedPtr<FStreamableHandle>> WaveLoadHandles;
+	TBitArray<> WaveLoaded;
+
+	// Subscription to UEnemyRegistrySubsystem::OnEnemyKilled
+	FDelegateHandle EnemyKilledHandle;
+
+	void BeginWave(int32 WaveIndex);
+	void RequestWaveLoad(int32 WaveIndex);
+	void HandleWaveLoaded(int32 WaveIndex);
+	void QueueWaveSpawns(int32 WaveIndex);
+	void ProcessSpawns();
+	void ProcessPrewarms();
+	void EndWave(bool bFromDeath);
+	void HandleRegisteredEnemyKilled(ACybersoulsEnemyBase* KilledEnemy);
+
+	TSubclassOf<ACybersoulsEnemyBase> ResolveEnemyClass(EEnemyType EnemyType) const;
+	FTransform PickSpawnTransform(const FEnemyWaveEntry& Entry, int32 Ordinal) const;
+	void ReportHitch(const TCHAR* Operation, const UClass* EnemyClass, double StartTime) const;
+};
@@ -7,6 +7,7 @@
 #include "cybersoulsGameMode.generated.h"
 
 class ACybersoulsEnemyBase;
+class AEnemyWaveSpawner;
 class UPlayerProgressionComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnQuestCompleted);
@@ -36,24 +37,60 @@ public:
 	void CompleteQuest();
 
 	UFUNCTION(BlueprintCallable, Category = "Quest")
-	int32 GetAliveEnemyCount() const { return AliveEnemies.Num(); }
+	int32 GetAliveEnemyCount() const;
+
+	// Wave spawners with waves left keep the quest open after the current enemies die
+	void RegisterWaveSpawner(AEnemyWaveSpawner* Spawner);
+	void UnregisterWaveSpawner(AEnemyWaveSpawner* Spawner);
+
+	UFUNCTION(BlueprintCallable, Category = "Quest")
+	bool HasPendingWaves() const;
+
+	/** Live enemies, read straight from UEnemyRegistrySubsystem */
+	const TArray<ACybersoulsEnemyBase*>& GetAliveEnemies() const;
 
 	// Restart functionality
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	void RestartLevel(bool bResetXP);
 
+	// Restart by restoring the level's initial state in place, reloading the map only if that fails
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Game")
+	bool bUseSoftReset = true;
+
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	void OnPlayerDeath();
 
+	/**
+	 * Drop combat still in flight against the current enemies
+	 * 
+	 * Discards queued damage and the player's Cascade Virus marks and delayed
+	 * kills. Call before parking enemies that are about to be respawned, or
+	 * the pooled actors come back and die to hits from before.
+	 */
+	void DiscardPendingCombat();
+
 protected:
 	virtual void BeginPlay() override;
 
 private:
-	// Enemy tracking for quest completion
-	UPROPERTY()
-	TArray<ACybersoulsEnemyBase*> AliveEnemies;
+	// Enemy tracking for quest completion lives in UEnemyRegistrySubsystem
+	class UEnemyRegistrySubsystem* GetEnemyRegistry() const;
 
 	void FindAndRegisterAllEnemies();
+
+	/** Restore the state captured at BeginPlay without reloading, false if the caller must reload */
+	bool SoftResetLevel();
+
+	// Enemies present when the level began, respawned through the enemy pool on a soft reset
+	struct FEnemySnapshot
+	{
+		TSubclassOf<ACybersoulsEnemyBase> EnemyClass;
+		FTransform Transform;
+	};
+
+	TArray<FEnemySnapshot> InitialEnemies;
+
+	TArray<TWeakObjectPtr<AEnemyWaveSpawner>> WaveSpawners;
 };
 
 
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Interface handle that resolves its dispatch path once
+ *
+ * Calling a BlueprintNativeEvent through Execute_ goes through reflection and
+ * ProcessEvent every time. When an object implements the interface in C++ and
+ * its class does not override any of the interface's events in Blueprint, the
+ * handle keeps the native interface pointer so calls can go straight to the
+ * _Implementation functions. Blueprint-only implementers, and native classes
+ * with Blueprint overrides, keep using Execute_.
+ *
+ * Whether a class overrides an event in Blueprint is worked out once per class.
+ * Game thread only.
+ */
+template<typename InterfaceType>
+class TCachedInterface
+{
+public:
+    TCachedInterface() = default;
+
+    explicit TCachedInterface(UObject* InObject)
+    {
+        Reset(InObject);
+    }
+
+    /** Point the handle at a new object, resolving its dispatch path */
+    void Reset(UObject* InObject)
+    {
+        Object = InObject;
+        Native = nullptr;
+        bImplements = InObject && InObject->GetClass()->ImplementsInterface(InterfaceType::UClassType::StaticClass());
+
+        if (bImplements && IsNativeDispatchSafe(InObject->GetClass()))
+        {
+            Native = Cast<InterfaceType>(InObject);
+        }
+    }
+
+    /** Object the handle was resolved for, null once it has been destroyed */
+    UObject* GetObject() const { return Object.Get(); }
+
+    /** True if the object was resolved for and implements the interface */
+    bool Implements() const { return bImplements && Object.IsValid(); }
+
+    /** Native pointer for direct _Implementation calls, or nullptr when Execute_ is required */
+    InterfaceType* GetNative() const { return Object.IsValid() ? Native : nullptr; }
+
+    /** True if the handle still refers to InObject */
+    bool IsFor(const UObject* InObject) const { return Object.Get() == InObject && InObject != nullptr; }
+
+private:
+    TWeakObjectPtr<UObject> Object;
+    InterfaceType* Native = nullptr;
+    bool bImplements = false;
+
+    // A Blueprint override of any interface event makes the _Implementation shortcut wrong
+    static bool IsNativeDispatchSafe(const UClass* Class)
+    {
+        static TMap<FObjectKey, bool> SafeClasses;
+
+        if (const bool* Cached = SafeClasses.Find(Class))
+        {
+            return *Cached;
+        }
+
+        bool bSafe = true;
+        for (TFieldIterator<UFunction> It(InterfaceType::UClassType::StaticClass()); It && bSafe; ++It)
+        {
+            const UFunction* Function = Class->FindFunctionByName(It->GetFName());
+            bSafe = !Function || Function->HasAnyFunctionFlags(FUNC_Native);
+        }
+
+        SafeClasses.Add(Class, bSafe);
+        return bSafe;
+    }
+};
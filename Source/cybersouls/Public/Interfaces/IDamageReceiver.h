@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "cybersouls/Public/Interfaces/CachedInterface.h"
 #include "IDamageReceiver.generated.h"
 
 // Damage type enumeration
@@ -55,6 +56,21 @@ public:
      */
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Damage")
     float GetDamageResistance(EDamageType DamageType) const;
+
+    /**
+     * GetDamageResistance through a cached handle
+     * @param Receiver Handle resolved for the receiver
+     * @param DamageType The type of damage
+     * @return The native result when available, otherwise the Execute_ result, 1 if not a receiver
+     */
+    static float DispatchGetDamageResistance(const TCachedInterface<IDamageReceiver>& Receiver, EDamageType DamageType)
+    {
+        if (const IDamageReceiver* Native = Receiver.GetNative())
+        {
+            return Native->GetDamageResistance_Implementation(DamageType);
+        }
+        return Receiver.Implements() ? Execute_GetDamageResistance(Receiver.GetObject(), DamageType) : 1.0f;
+    }
     
     /**
      * Called when this actor dies
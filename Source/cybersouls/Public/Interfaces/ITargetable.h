@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
 #include "cybersouls/Public/CybersoulsUtils.h"
+#include "cybersouls/Public/Interfaces/CachedInterface.h"
 #include "ITargetable.generated.h"
 
 UINTERFACE(MinimalAPI, Blueprintable)
@@ -48,4 +49,33 @@ public:
      */
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Targeting")
     bool IsValidTargetForAbility(TSubclassOf<UObject> AbilityClass) const;
+
+    /**
+     * CanBeTargeted through a cached handle
+     * @param Target Handle resolved for the target
+     * @return The native result when available, otherwise the Execute_ result
+     */
+    static bool DispatchCanBeTargeted(const TCachedInterface<ITargetable>& Target)
+    {
+        if (const ITargetable* Native = Target.GetNative())
+        {
+            return Native->CanBeTargeted_Implementation();
+        }
+        return Target.Implements() && Execute_CanBeTargeted(Target.GetObject());
+    }
+
+    /**
+     * GetTargetBodyPart through a cached handle
+     * @param Target Handle resolved for the target
+     * @param HitLocation The world location of the potential hit
+     * @return The native result when available, otherwise the Execute_ result
+     */
+    static EBodyPart DispatchGetTargetBodyPart(const TCachedInterface<ITargetable>& Target, const FVector& HitLocation)
+    {
+        if (const ITargetable* Native = Target.GetNative())
+        {
+            return Native->GetTargetBodyPart_Implementation(HitLocation);
+        }
+        return Target.Implements() ? Execute_GetTargetBodyPart(Target.GetObject(), HitLocation) : EBodyPart::None;
+    }
 };
\ No newline at end of file
@@ -56,6 +56,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Character Pool")
     void SwapActiveCharacter();
 
+    /**
+     * Put the pool back in its initialized state: default character shown, cyber state hidden
+     */
+    void ResetPool();
+
     /**
      * Clean up the pool
      */
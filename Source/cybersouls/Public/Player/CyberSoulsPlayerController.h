@@ -11,6 +11,7 @@ class UInputMappingContext;
 class UCyberSoulsInputConfig;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCharacterSwitched, APawn*, NewCharacter);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCharacterSwitchedNative, APawn*);
 
 /**
  * Main player controller for Cybersouls
@@ -36,12 +37,43 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnCharacterSwitched OnCharacterSwitched;
 
+    /** Fired alongside OnCharacterSwitched, for native listeners that subscribe once such as the enemy AI */
+    FOnCharacterSwitchedNative OnCharacterSwitchedNative;
+
     UFUNCTION(BlueprintCallable, Category = "Character Switching")
     void SwitchCharacter();
 
     UFUNCTION(BlueprintCallable, Category = "Character Switching")
     bool IsUsingCyberState() const { return bIsUsingCyberState; }
 
+    /** Time from the last switch input to the first frame the new character was controllable */
+    UFUNCTION(BlueprintCallable, Category = "Character Switching")
+    float GetLastSwitchLatencyMs() const { return LastSwitchLatencyMs; }
+
+    /**
+     * Put the player back at the start of the level without reloading it
+     * 
+     * Resets the character pool to the default character at its initial
+     * transform and restores attributes, stamina and abilities on both
+     * characters.
+     * 
+     * @return False if the character pool was never initialized
+     */
+    bool ResetForLevelRestart();
+
+    /** One of the two pooled characters whether or not it is active, nullptr before the pool exists */
+    ACharacter* GetPooledCharacter(bool bCyberState) const;
+
+    /**
+     * Make the given pooled character active and place it, for loading a checkpoint
+     * 
+     * @param bCyberState Which character should be possessed
+     * @param Transform Where the active character stands
+     * @param ControlRotation Camera rotation to restore
+     * @return False if the character pool was never initialized
+     */
+    bool RestoreActiveCharacter(bool bCyberState, const FTransform& Transform, const FRotator& ControlRotation);
+
     // Enhanced Input
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
     UInputMappingContext* ControllerMappingContext;
@@ -59,6 +91,7 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void SetupInputComponent() override;
+    virtual void PlayerTick(float DeltaTime) override;
 
 private:
     UPROPERTY()
@@ -67,12 +100,22 @@ private:
     bool bIsUsingCyberState;
 
     void InitializeCharacterPool();
-    void SwitchToDefaultCharacter();
-    void SwitchToCyberStateCharacter();
+    void SwitchToCharacter(bool bCyberState);
     void TransferCameraSettings(APawn* FromPawn, APawn* ToPawn);
     void StoreCharacterState(APawn* CharacterPawn);
     void RestoreCharacterState(APawn* CharacterPawn);
-    void UpdateAllAIControllers();
+    void ApplyCharacterMappingPriorities();
+    void BroadcastCharacterSwitched(APawn* NewCharacter);
+    void ResetCharacterForRestart(ACharacter* Character);
+    
+    // Where the default character was placed when the pool was initialized
+    FTransform InitialPlayerTransform;
+    
+    // Switch latency, measured from the input until PlayerTick runs in a later frame
+    uint64 SwitchStartCycles = 0;
+    uint64 SwitchStartFrame = 0;
+    bool bSwitchLatencyPending = false;
+    float LastSwitchLatencyMs = 0.0f;
     
     // Character state preservation
     struct FCharacterState
@@ -69,6 +69,8 @@ public:
      */
     virtual void DeactivateAbility() override;
 
+    virtual void ResetAbility() override;
+
     UFUNCTION(BlueprintCallable, Category = "Charges")
     int32 GetCurrentCharges() const { return CurrentCharges; }
 
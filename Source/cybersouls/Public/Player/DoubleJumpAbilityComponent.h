@@ -26,6 +26,7 @@ public:
     virtual bool CanActivateAbility() override;
     virtual void ActivateAbility() override;
     virtual void DeactivateAbility() override;
+    virtual void ResetAbility() override;
     
     void ResetJumpCount();
 
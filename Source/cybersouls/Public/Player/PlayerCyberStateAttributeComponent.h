@@ -38,6 +38,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Stamina")
     float GetStaminaPercentage() const { return CurrentStamina / MaxStamina; }
 
+    // Back to full stamina, used when the level is soft reset
+    void ResetStamina();
+
+    // Set stamina outright, used when a checkpoint is loaded
+    void SetCurrentStamina(float NewStamina);
+
 protected:
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
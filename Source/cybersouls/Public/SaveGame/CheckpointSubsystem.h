@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "CheckpointSubsystem.generated.h"
+
+struct FCheckpointData;
+
+/**
+ * Quick save of the live combat state, loaded in place without reloading the level
+ *
+ * A checkpoint holds every live enemy (class, transform, integrity, block and
+ * dodge charges, QuickHack casts and cooldowns), the attributes, stamina and
+ * QuickHacks of both pooled player characters and which of them is active.
+ * It is captured into a small versioned binary layout on the game thread;
+ * compression and the file write happen on a background task. The latest
+ * checkpoint is also kept in memory, so loading it never waits on the disk.
+ * The file header carries a CRC of the payload, and a file that fails it is
+ * ignored rather than parsed.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UCheckpointSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Convenience accessor, returns nullptr if the world has no checkpoint subsystem */
+    static UCheckpointSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Deinitialize() override;
+
+    /** Capture the current combat state and write it in the background */
+    UFUNCTION(BlueprintCallable, Category = "Checkpoint")
+    bool SaveCheckpoint();
+
+    /**
+     * Put the world back as the latest checkpoint left it
+     *
+     * Enemies are parked and respawned through UEnemyPoolSubsystem. Falls back
+     * to the checkpoint file when this session has not saved one.
+     *
+     * @return False without a checkpoint for this map
+     */
+    UFUNCTION(BlueprintCallable, Category = "Checkpoint")
+    bool LoadCheckpoint();
+
+    UFUNCTION(BlueprintCallable, Category = "Checkpoint")
+    bool HasCheckpoint() const;
+
+    // Compress the checkpoint file, done on the write task
+    UPROPERTY(Config, EditAnywhere, Category = "Checkpoint")
+    bool bCompressCheckpoints = true;
+
+    // File under Saved/SaveGames
+    UPROPERTY(Config, EditAnywhere, Category = "Checkpoint")
+    FString CheckpointFileName = TEXT("CybersoulsCheckpoint.bin");
+
+private:
+    // Uncompressed payload of the latest checkpoint
+    TArray<uint8> LatestPayload;
+
+    // Writes run in order, each waiting on the one before
+    UE::Tasks::FTask WriteTask;
+
+    FString GetCheckpointPath() const;
+
+    void CaptureCheckpoint(FCheckpointData& Data) const;
+    bool ApplyCheckpoint(const FCheckpointData& Data);
+    bool ReadCheckpointFile(TArray<uint8>& OutPayload) const;
+};
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Replaces whole files so that a crash always leaves one complete version behind
+ *
+ * The new bytes go to a ".tmp" file beside the target first. The old file is
+ * deleted only once that write has finished, then the temp file is renamed
+ * into place. A rename over an existing file is not atomic on every platform,
+ * so a crash can still land between the delete and the rename. Recover
+ * finishes that rename, which is safe because the temp file is complete by
+ * then. A temp file found next to the target is a write that was cut short,
+ * and it is discarded.
+ */
+class CYBERSOULS_API FCrashSafeFile
+{
+public:
+    /** Replace Path with Bytes, false if Path still holds its previous contents */
+    static bool Write(const TArray<uint8>& Bytes, const FString& Path);
+
+    /** Complete or discard a write interrupted by a crash, call before reading Path */
+    static void Recover(const FString& Path);
+
+    static FString GetTempPath(const FString& Path) { return Path + TEXT(".tmp"); }
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/SaveGame.h"
+#include "cybersouls/Public/Abilities/QuickHackComponent.h"
 #include "CybersoulsSaveGame.generated.h"
 
 UCLASS()
@@ -19,6 +20,17 @@ public:
     UPROPERTY(SaveGame)
     float HackingXP;
 
+    // QuickHack unlocks beyond the defaults, and the slot loadout (index 0 is slot 1)
+    UPROPERTY(SaveGame)
+    TArray<EQuickHackType> UnlockedQuickHacks;
+
+    UPROPERTY(SaveGame)
+    TArray<EQuickHackType> EquippedQuickHacks;
+
+    // Last progression journal record folded into this save
+    UPROPERTY(SaveGame)
+    uint32 JournalSequence;
+
     // Save slot name
     static const FString SaveSlotName;
     static const int32 UserIndex;
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "cybersouls/Public/Abilities/QuickHackComponent.h"
+#include "cybersouls/Public/SaveGame/ProgressionJournal.h"
+#include "CybersoulsSaveSubsystem.generated.h"
+
+class UCybersoulsSaveGame;
+
+/**
+ * Writes UCybersoulsSaveGame to disk without blocking the game thread
+ *
+ * A save is serialized on the game thread and written by a background task
+ * through FCrashSafeFile, so a crash mid-write keeps the previous save slot
+ * intact instead of tearing it. While a write is in flight, further requests
+ * only replace the pending save, so back-to-back saves coalesce and just the
+ * latest state reaches the disk. Lives on the game instance so a write
+ * survives a map reload, and flushes on shutdown.
+ *
+ * Progression changes between saves go to FProgressionJournal as they happen.
+ * The save slot is the snapshot: loading replays the journal on top of it, and
+ * once the journal grows past CompactAfterRecords the current state is saved
+ * and the records it covers are dropped.
+ */
+UCLASS(config=Game)
+class CYBERSOULS_API UCybersoulsSaveSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Convenience accessor, returns nullptr without a game instance */
+    static UCybersoulsSaveSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Queue a save of the progression slot
+     *
+     * @param SaveGame Save to write, must not be modified afterwards
+     */
+    void RequestSave(UCybersoulsSaveGame* SaveGame);
+
+    /**
+     * Finish every requested save before returning, for shutdown
+     *
+     * Waits for the write in flight, then writes any pending save synchronously.
+     *
+     * @param TimeoutSeconds Longest to wait for the write in flight
+     * @return True if the latest requested save is on disk
+     */
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    bool FlushAndWait(float TimeoutSeconds = 5.0f);
+
+    /** Most recently requested save, newer than the disk while writes are outstanding */
+    UCybersoulsSaveGame* GetLatestSave() const { return LatestSave; }
+
+    bool HasOutstandingWrites() const { return bWriteInFlight || PendingSave != nullptr; }
+
+    /** Snapshot plus every journaled change, the progression to restore */
+    const UCybersoulsSaveGame* GetProgressionState() const { return ProgressionState; }
+
+    // Journal a progression change, each costs one small file append
+    void RecordIntegrityXP(float Amount);
+    void RecordHackingXP(float Amount);
+    void RecordQuickHackUnlocked(EQuickHackType QuickHack);
+    void RecordQuickHackEquipped(int32 SlotIndex, EQuickHackType QuickHack);
+    void RecordProgressionReset();
+
+    /** Save the progression state as a new snapshot, letting the journal shrink once it is written */
+    void CompactProgression();
+
+    /** Snapshot on disk without the journal replayed, nullptr if there is none */
+    UCybersoulsSaveGame* LoadSnapshot() const;
+
+    /**
+     * Keep the snapshot and journal under another slot name, so automation tests leave the player's save alone
+     *
+     * Must be set before Initialize or the first save.
+     */
+    void SetSlotNameOverride(const FString& InSlotName) { SlotNameOverride = InSlotName; }
+
+    // File every snapshot is written to and loaded from, where the save game system keeps the slot on desktop platforms
+    FString GetSnapshotPath() const;
+
+    // Journal records before a snapshot is saved on its own
+    UPROPERTY(Config, EditAnywhere, Category = "Save")
+    int32 CompactAfterRecords = 64;
+
+private:
+    UPROPERTY()
+    UCybersoulsSaveGame* LatestSave = nullptr;
+
+    // Waiting for the write in flight to finish, replaced by newer requests
+    UPROPERTY()
+    UCybersoulsSaveGame* PendingSave = nullptr;
+
+    // Being written by the background task
+    UPROPERTY()
+    UCybersoulsSaveGame* InFlightSave = nullptr;
+
+    UPROPERTY()
+    UCybersoulsSaveGame* ProgressionState = nullptr;
+
+    FProgressionJournal Journal;
+    uint32 LastJournalSequence = 0;
+
+    bool bWriteInFlight = false;
+    bool bLastWriteSucceeded = true;
+
+    void StartWrite(UCybersoulsSaveGame* SaveGame);
+    void HandleWriteFinished(bool bSuccess);
+    void HandleSaveWritten(UCybersoulsSaveGame* SaveGame, bool bSuccess);
+
+    void AppendRecord(FProgressionRecord& Record);
+    void ApplyRecord(const FProgressionRecord& Record);
+    FString SlotNameOverride;
+
+    const FString& GetSlotName() const;
+    FString GetJournalPath() const;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+class IFileHandle;
+
+enum class EProgressionRecordType : uint8
+{
+    IntegrityXP,
+    HackingXP,
+    QuickHackUnlocked,
+    QuickHackEquipped,
+    Reset
+};
+
+/** One journaled progression change */
+struct FProgressionRecord
+{
+    // Increases by one per record, never zero
+    uint32 Sequence = 0;
+
+    EProgressionRecordType Type = EProgressionRecordType::IntegrityXP;
+
+    // QuickHack records only
+    uint8 Slot = 0;
+    uint8 QuickHack = 0;
+
+    // XP records only
+    float Value = 0.0f;
+};
+
+/**
+ * Append-only file of the progression changes made since the last snapshot
+ *
+ * Every record is a fixed 16 bytes ending in a CRC and goes out in a single
+ * unflushed write, so appending costs about as much as a memcpy into the OS
+ * cache and survives the game crashing. Reading stops at the first record that
+ * is short or fails its CRC, which means a torn write loses only that record.
+ * Records covered by a snapshot stay in the file, replay skips them, until
+ * none are left uncovered and the file can simply be truncated. The file is
+ * only rewritten on open or after a failed append, through FCrashSafeFile.
+ */
+class CYBERSOULS_API FProgressionJournal
+{
+public:
+    static constexpr int32 RecordSize = 16;
+
+    ~FProgressionJournal();
+
+    /**
+     * Open the journal for appending, replaying what it holds
+     *
+     * @param InPath Journal file, created if missing
+     * @param AfterSequence Records up to this sequence are in the snapshot and skipped
+     * @param Replay Called for each intact record newer than the snapshot, oldest first
+     * @return Last sequence used, AfterSequence if the journal had nothing newer
+     */
+    uint32 Open(const FString& InPath, uint32 AfterSequence, TFunctionRef<void(const FProgressionRecord&)> Replay);
+
+    void Close();
+
+    /** Write one record, false if it did not reach the file */
+    bool Append(const FProgressionRecord& Record);
+
+    /** Forget every record a snapshot now covers, truncating the file once nothing newer is left */
+    void DiscardThrough(uint32 Sequence);
+
+    bool IsOpen() const { return Handle.IsValid(); }
+
+    /** Records on disk that no snapshot covers yet */
+    int32 Num() const { return Records.Num(); }
+
+private:
+    FString Path;
+    TUniquePtr<IFileHandle> Handle;
+
+    // Records no snapshot covers yet, oldest first. The file may still hold covered ones ahead of them.
+    TArray<FProgressionRecord> Records;
+
+    bool OpenForAppend(bool bAppend);
+    bool Rewrite();
+
+    static void Encode(const FProgressionRecord& Record, uint8* Out);
+    static bool Decode(const uint8* In, FProgressionRecord& OutRecord);
+};
\ No newline at end of file
@@ -106,6 +106,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UI")
 	void ForceCloseInventory();
 	
+	// Drop end-of-level screens after a soft level reset
+	void ResetForLevelRestart();
+	
 	bool IsShowingDeathScreen() const { return bShowDeathScreen; }
 	bool IsShowingPlayAgainButton() const { return bShowPlayAgainButton; }
 };
\ No newline at end of file
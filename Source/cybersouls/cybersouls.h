@@ -3,3 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+
+// Gameplay performance counters, view with "stat Cybersouls"
+DECLARE_STATS_GROUP(TEXT("Cybersouls"), STATGROUP_Cybersouls, STATCAT_Advanced);
+
+// Simple-collision trace channel for crosshair targeting, see DefaultEngine.ini
+#define ECC_Targeting ECC_GameTraceChannel1